@@ -0,0 +1,537 @@
+/*
+ * Render / parse microbenchmarks (env:native only)
+ *
+ * Runs the firmware's hot paths against the NativeHost stand-ins and prints
+ * ns per frame for every screen mode and ns per packet for both wire
+ * formats, plus the I2C bytes each frame puts on the bus.
+ *
+ *   pio run -e native -t exec
+ *   .pio/build/native/program [iterations]
+ *   .pio/build/native/program --trace   # Mario clock frame trace
+ *   .pio/build/native/program --http-load [passes]
+ *   .pio/build/native/program --latency [packets]  # fake sender, checks /metrics
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <WiFiUDP.h>
+#include <Adafruit_SSD1306.h>
+#include <WiFi.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "DisplayFlush.h"
+#include "StatsProtocol.h"
+
+// Firmware entry points under test
+void setup();
+void loop();
+void parseStats(const char* data, int len, uint32_t ip, uint32_t rx_us = 0);
+bool receivePackets();
+bool updateHostPages(unsigned long now);
+void publishSnapshot();
+void readSnapshot();
+void serviceHttp();
+void displayStats();
+void displayHistory();
+void displayCores();
+void displayStandardClock();
+void displayLargeClock();
+void displayClockWithMario();
+void drawTimeWithBounce();
+void drawMario(int x, int y, bool facingRight, int frame, bool jumping);
+
+extern Adafruit_SSD1306 display;
+extern WiFiUDP udp;
+extern DisplayFlush displayFlush;
+
+static const time_t BENCH_EPOCH = 1700000000;  // 22:13:20 UTC
+static const int ROUNDS = 5;
+static const int SCREEN_BYTES = 128 * 64 / 8;
+static const uint32_t BENCH_IP = 0x1701A8C0;  // 192.168.1.23
+
+static const char JSON_PACKET[] =
+  "{\"timestamp\": \"14:37\", \"cpu_percent\": 23.4, \"ram_percent\": 61.2, "
+  "\"ram_used_gb\": 19.6, \"ram_total_gb\": 31.3, \"disk_percent\": 48.9, "
+  "\"cpu_temp\": 54, \"gpu_temp\": 47, \"fan_speed\": 1840, \"status\": \"online\"}";
+
+static uint8_t binary_packet[STATS_PACKET_SIZE];
+
+static void buildBinaryPacket(uint16_t seq) {
+  StatsWire w = {};
+  w.seq = seq;
+  w.present = 0x1FF;
+  w.cpu_percent_x10 = 234;
+  w.ram_percent_x10 = 612;
+  w.ram_used_x10 = 196;
+  w.ram_total_x10 = 313;
+  w.disk_percent_x10 = 489;
+  w.cpu_temp = 54;
+  w.gpu_temp = 47;
+  w.fan_speed = 1840;
+  w.hour = 14;
+  w.minute = 37;
+  statsWireEncode(w, binary_packet, sizeof(binary_packet));
+}
+
+// The same keyframe plus per-core load for a 32-core machine
+static const int BENCH_CORES = 32;
+static uint8_t cores_packet[STATS_PACKET_SIZE + 1 + BENCH_CORES];
+
+static void buildCoresPacket() {
+  StatsWire w = {};
+  statsWireDecode(binary_packet, sizeof(binary_packet), w);
+  w.flags |= STATS_FLAG_CORES;
+  w.core_count = BENCH_CORES;
+  for (int i = 0; i < BENCH_CORES; i++) w.cores[i] = (i * 37) % 201;
+  statsWireEncode(w, cores_packet, sizeof(cores_packet));
+}
+
+// Best-of-ROUNDS average ns per call of fn(i)
+template <typename Fn>
+static double measure(int iterations, Fn fn) {
+  using clock = std::chrono::steady_clock;
+  double best = 1e300;
+  for (int r = 0; r < ROUNDS; r++) {
+    auto t0 = clock::now();
+    for (int i = 0; i < iterations; i++) fn(i);
+    auto t1 = clock::now();
+    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / iterations;
+    if (ns < best) best = ns;
+  }
+  return best;
+}
+
+static void report(const char* name, double ns, const char* unit, double i2c_bytes = -1) {
+  if (i2c_bytes >= 0) {
+    printf("  %-34s %10.0f ns/%-6s %8.0f I2C B/frame\n", name, ns, unit, i2c_bytes);
+  } else {
+    printf("  %-34s %10.0f ns/%-6s\n", name, ns, unit);
+  }
+}
+
+// Render one frame the way loop() does: clear, draw, flush
+template <typename Render>
+static void benchScreen(const char* name, int iterations, Render render) {
+  uint64_t bytes0 = Wire.bytesWritten;
+  uint64_t frames = 0;
+  double ns = measure(iterations, [&](int i) {
+    display.clearDisplay();
+    render(i);
+    displayFlush.flush();
+    frames++;
+  });
+  report(name, ns, "frame", (double)(Wire.bytesWritten - bytes0) / frames);
+}
+
+// Keep the mock wall clock inside the Mario window (second 55..59) so
+// every measured frame has Mario walking, jumping or a digit bouncing
+static void stayInMarioWindow() {
+  static time_t epoch = BENCH_EPOCH;
+  mockAdvanceMillis(50);
+  int sec = time(nullptr) % 60;
+  if (sec < 55) {
+    epoch += 55 - sec;
+    mockSetEpoch(epoch);
+  }
+}
+
+// One request through the server's real accept/read/write path
+static std::string httpRequest(const std::string& request) {
+  auto socket = WiFiServer::mockConnect(80, request);
+  for (int pass = 0; pass < 1000 && !socket->closed; pass++) serviceHttp();
+  return socket->out;
+}
+
+static std::string responseHeader(const std::string& response, const char* name) {
+  std::string key = std::string("\r\n") + name + ": ";
+  size_t at = response.find(key);
+  if (at == std::string::npos) return "";
+  at += key.size();
+  return response.substr(at, response.find("\r\n", at) - at);
+}
+
+// Render passes (stats screen + flush + one HTTP poll, as the host build's
+// loop() does) with no clients, then with the server saturated: slow
+// readers taking 64 bytes per write on every endpoint, clients that stall
+// mid-header, and more connections than the cap. Prints avg, p99 and worst
+// pass; HTTP work per poll() is bounded, so the loaded p99 should stay
+// close to the idle one (the worst pass is mostly host scheduling noise).
+static int httpLoad(int passes) {
+  using clock = std::chrono::steady_clock;
+  static const char* const REQUESTS[] = {
+    "GET / HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n",
+    "GET /metrics HTTP/1.1\r\n\r\n",
+    "GET /api/settings HTTP/1.1\r\n\r\n",
+    "GET /api/settings HTTP/1.1\r\nHost: pcmon",  // Stalls mid-header
+  };
+  const int CLIENTS = 8;  // Twice the connection cap
+
+  mockSetEpoch(BENCH_EPOCH);
+  setup();
+  parseStats(JSON_PACKET, sizeof(JSON_PACKET) - 1, BENCH_IP);
+  updateHostPages(millis());
+  publishSnapshot();
+  readSnapshot();
+
+  // Requests the server must refuse before reading a body: a Content-Length
+  // that would wrap past the buffer end, a negative one, or not a number
+  static const struct { const char* request; const char* status; } LIMITS[] = {
+    {"POST /api/settings HTTP/1.1\r\nContent-Length: 4294967295\r\n\r\n", "413"},
+    {"POST /api/settings HTTP/1.1\r\nContent-Length: 18446744073709551615\r\n\r\n", "413"},
+    {"POST /api/settings HTTP/1.1\r\nContent-Length: 99999999999999999999999\r\n\r\n", "413"},
+    {"POST /api/settings HTTP/1.1\r\nContent-Length: 1000\r\n\r\n", "413"},
+    {"POST /api/settings HTTP/1.1\r\nContent-Length: -5\r\n\r\n", "400"},
+    {"POST /api/settings HTTP/1.1\r\nContent-Length: 5x\r\n\r\n", "400"},
+  };
+  int failures = 0;
+  printf("Request limits\n");
+  for (const auto& limit : LIMITS) {
+    std::string response = httpRequest(limit.request);
+    bool ok = response.size() > 12 && response.compare(9, 3, limit.status) == 0;
+    failures += !ok;
+    std::string line = limit.request;
+    line = line.substr(0, line.find("\r\n\r\n"));
+    line.replace(line.find("\r\n"), 2, ", ");
+    printf("  %-70s %.3s  %s\n", line.c_str(), response.size() > 9 ? response.c_str() + 9 : "---",
+           ok ? "ok" : "MISMATCH");
+  }
+  printf("\n");
+
+  printf("HTTP load: %d render passes each\n\n", passes);
+  for (int loaded = 0; loaded < 2; loaded++) {
+    std::vector<std::shared_ptr<MockSocket>> clients(CLIENTS);
+    unsigned long responses = 0;
+    std::vector<double> times;
+    times.reserve(passes);
+
+    for (int pass = 0; pass < passes; pass++) {
+      if (loaded) {
+        for (int i = 0; i < CLIENTS; i++) {
+          if (clients[i] && !clients[i]->closed) continue;
+          if (clients[i]) responses++;
+          clients[i] = WiFiServer::mockConnect(80, REQUESTS[(pass + i) % 4]);
+          clients[i]->write_budget = 64;
+        }
+      }
+      mockAdvanceMillis(1);
+
+      auto t0 = clock::now();
+      display.clearDisplay();
+      displayStats();
+      displayFlush.flush();
+      serviceHttp();
+      times.push_back(std::chrono::duration<double, std::nano>(clock::now() - t0).count());
+    }
+
+    double total_ns = 0;
+    for (double ns : times) total_ns += ns;
+    std::sort(times.begin(), times.end());
+    printf("  %-24s %8.0f ns avg %8.0f ns p99 %8.0f ns worst",
+           loaded ? "8 clients, 64 B/write" : "idle", total_ns / passes,
+           times[times.size() * 99 / 100], times.back());
+    if (loaded) printf("   %lu responses", responses);
+    printf("\n");
+  }
+  return failures ? 1 : 0;
+}
+
+// Value of one sample line in a /metrics response, -1 if missing
+static long metricValue(const std::string& metrics, const std::string& series) {
+  size_t at = metrics.find("\n" + series + " ");
+  if (at == std::string::npos) return -1;
+  return atol(metrics.c_str() + at + series.size() + 2);
+}
+
+// p50/p99/max over the last StageStats::SAMPLES values, as the firmware
+// computes them
+static void percentiles(std::vector<uint32_t> v, long out[3]) {
+  if (v.size() > 128) v.erase(v.begin(), v.end() - 128);
+  std::sort(v.begin(), v.end());
+  size_t n = v.size();
+  out[0] = n ? v[(n * 50 - 1) / 100] : 0;
+  out[1] = n ? v[(n * 99 - 1) / 100] : 0;
+  out[2] = n ? v.back() : 0;
+}
+
+// Fake sender driving the firmware's own receive -> parse -> render ->
+// flush path. Packets (binary, every third one JSON) carry seq and
+// send_ms and arrive after a known network delay of 2-16 ms with spikes;
+// some are lost and some are overtaken by the next one. The I2C bus is
+// timed at the panel clock. The latency percentiles and loss/reorder
+// counters on /metrics must match what was injected: network delay above
+// the fastest packet, 0 us parse (the mock clock stands still) and the
+// bus time of each frame for display.
+static int latencyHarness(int packets) {
+  const unsigned long INTERVAL = 250;
+  const uint32_t SENDER_CLOCK = 4294867296u;  // Sender's ms clock wraps 100 s in
+  struct Arrival {
+    unsigned long at;  // Our millis()
+    int index;
+    uint32_t send_ms;
+    int delay;
+  };
+
+  mockSetEpoch(BENCH_EPOCH);
+  setup();
+  Wire.mockTimed = true;
+
+  std::vector<Arrival> arrivals;
+  uint32_t rng = 12345;
+  unsigned long start = millis() + 1000;
+  long expect_dropped = 0;
+  long expect_reordered = 0;
+  for (int i = 0; i < packets; i++) {
+    rng = rng * 1103515245u + 12345u;
+    int delay = (i % 16 == 0) ? 2 : 2 + (int)((rng >> 16) % 15);
+    if (i % 20 == 7) delay += 60;  // Spike
+    if (i % 50 == 49 && i < packets - 1) {  // Lost (a trailing loss is never seen)
+      expect_dropped++;
+      continue;
+    }
+    if (i % 40 == 23) {  // Overtaken: the gap counts as dropped, then it's late
+      delay = INTERVAL + 30;
+      expect_dropped++;
+      expect_reordered++;
+    }
+    unsigned long sent = start + i * INTERVAL;
+    arrivals.push_back({sent + delay, i, SENDER_CLOCK + (uint32_t)sent, delay});
+  }
+  std::stable_sort(arrivals.begin(), arrivals.end(),
+                   [](const Arrival& a, const Arrival& b) { return a.at < b.at; });
+
+  std::vector<uint32_t> network, display;
+  int newest = -1;
+  for (const Arrival& a : arrivals) {
+    uint8_t packet[STATS_PACKET_MAX_SIZE];
+    char json[160];
+    uint16_t cpu = (a.index * 37) % 1000;  // Changes the frame every packet
+    if (a.index % 3 == 2) {
+      int n = snprintf(json, sizeof(json),
+                       "{\"seq\": %d, \"send_ms\": %u, \"cpu_percent\": %.1f, "
+                       "\"ram_percent\": 61.2, \"cpu_temp\": 54}",
+                       a.index & 0xFFFF, a.send_ms, cpu / 10.0);
+      udp.mockInject(json, n);
+    } else {
+      StatsWire w = {};
+      w.flags = STATS_FLAG_SEND_TIME;
+      w.seq = a.index;
+      w.present = STATS_FIELD_CPU_PERCENT | STATS_FIELD_RAM_PERCENT | STATS_FIELD_CPU_TEMP;
+      w.cpu_percent_x10 = cpu;
+      w.ram_percent_x10 = 612;
+      w.cpu_temp = 54;
+      w.send_ms = a.send_ms;
+      udp.mockInject(packet, statsWireEncode(w, packet, sizeof(packet)));
+    }
+
+    if (millis() < a.at) mockSetMillis(a.at);
+    uint32_t arrived = micros();
+    loop();
+
+    if (a.index < newest) continue;  // Late: discarded
+    network.push_back((a.delay - 2) * 1000);
+    if (newest >= 0) display.push_back(micros() - arrived);  // First frame isn't tagged
+    newest = a.index;
+  }
+
+  std::string metrics = httpRequest("GET /metrics HTTP/1.1\r\n\r\n");
+  const char* const STAGES[] = {"network", "parse", "display"};
+  const char* const STATS[] = {"p50", "p99", "max"};
+  long expected[3][3];
+  std::vector<uint32_t> zeros(network.size(), 0);
+  percentiles(network, expected[0]);
+  percentiles(zeros, expected[1]);
+  percentiles(display, expected[2]);
+
+  printf("Latency harness: %d packets %lu ms apart, 2-76 ms network delay\n\n", packets, INTERVAL);
+  printf("  %-8s %24s %24s\n", "", "/metrics p50/p99/max", "expected p50/p99/max");
+  int failures = 0;
+  for (int i = 0; i < 3; i++) {
+    long got[3];
+    for (int j = 0; j < 3; j++) {
+      got[j] = metricValue(metrics, std::string("pcmon_latency_us{stage=\"") + STAGES[i] +
+                                    "\",stat=\"" + STATS[j] + "\"}");
+    }
+    bool ok = got[0] == expected[i][0] && got[1] == expected[i][1] && got[2] == expected[i][2];
+    failures += !ok;
+    printf("  %-8s %8ld %7ld %7ld us %8ld %7ld %7ld us  %s\n", STAGES[i], got[0], got[1], got[2],
+           expected[i][0], expected[i][1], expected[i][2], ok ? "ok" : "MISMATCH");
+  }
+  long dropped = metricValue(metrics, "pcmon_packets_dropped_total");
+  long reordered = metricValue(metrics, "pcmon_packets_reordered_total");
+  bool counts_ok = dropped == expect_dropped && reordered == expect_reordered;
+  failures += !counts_ok;
+  printf("  dropped %ld (expected %ld), reordered %ld (expected %ld)  %s\n", dropped,
+         expect_dropped, reordered, expect_reordered, counts_ok ? "ok" : "MISMATCH");
+  return failures ? 1 : 0;
+}
+
+// Run the firmware's own loop() on the Mario clock across two minute
+// changes and print one line per framebuffer change: mock millis() and an
+// FNV-1a hash of the frame. Diffing this between builds shows whether an
+// animation change moved any pixel or frame.
+static int traceMario() {
+  mockSetEpoch(BENCH_EPOCH);
+  setup();
+  mockSetMillis(0);
+  mockSetEpoch(BENCH_EPOCH + 30);  // 22:13:50, Mario starts at :55
+
+  uint32_t last_hash = 0;
+  while (millis() < 130000) {
+    loop();
+    uint32_t hash = 2166136261u;
+    const uint8_t* buf = display.getBuffer();
+    for (int i = 0; i < SCREEN_BYTES; i++) hash = (hash ^ buf[i]) * 16777619u;
+    if (hash != last_hash) {
+      printf("%8lu %08x\n", millis(), hash);
+      last_hash = hash;
+    }
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  if (argc > 1 && strcmp(argv[1], "--trace") == 0) return traceMario();
+  if (argc > 1 && strcmp(argv[1], "--http-load") == 0) {
+    return httpLoad(argc > 2 ? atoi(argv[2]) : 20000);
+  }
+  if (argc > 1 && strcmp(argv[1], "--latency") == 0) {
+    return latencyHarness(argc > 2 ? atoi(argv[2]) : 2000);
+  }
+
+  int iterations = argc > 1 ? atoi(argv[1]) : 2000;
+  if (iterations <= 0) iterations = 2000;
+
+  mockSetEpoch(BENCH_EPOCH);
+  setup();
+  buildBinaryPacket(0);
+  buildCoresPacket();
+
+  printf("PC Monitor native benchmarks: %d iterations, best of %d rounds\n\n", iterations, ROUNDS);
+
+  printf("Packet parsing\n");
+  report("parseStats JSON (~240 B)", measure(iterations, [](int) {
+    parseStats(JSON_PACKET, sizeof(JSON_PACKET) - 1, BENCH_IP);
+  }), "packet");
+  report("parseStats binary (24 B)", measure(iterations, [](int i) {
+    binary_packet[4] = i & 0xFF;
+    parseStats((const char*)binary_packet, sizeof(binary_packet), BENCH_IP);
+  }), "packet");
+  report("parseStats delta (CPU only, 10 B)", measure(iterations, [](int i) {
+    static uint8_t delta[STATS_PACKET_MAX_SIZE];
+    static size_t delta_len = 0;
+    if (!delta_len) {
+      StatsWire w = {};
+      w.flags = STATS_FLAG_DELTA;
+      w.present = STATS_FIELD_CPU_PERCENT;
+      w.cpu_percent_x10 = 250;
+      delta_len = statsWireEncode(w, delta, sizeof(delta));
+    }
+    delta[4] = i & 0xFF;
+    parseStats((const char*)delta, delta_len, BENCH_IP);
+  }), "packet");
+  report("parseStats binary + 32 cores (57 B)", measure(iterations, [](int i) {
+    cores_packet[4] = i & 0xFF;
+    parseStats((const char*)cores_packet, sizeof(cores_packet), BENCH_IP);
+  }), "packet");
+  report("receivePackets, burst of 8", measure(iterations, [](int) {
+    static uint16_t seq = 0;
+    for (int n = 0; n < 8; n++) {
+      buildBinaryPacket(seq++);
+      udp.mockInject(binary_packet, sizeof(binary_packet));
+    }
+    receivePackets();
+  }), "burst");
+
+  printf("\nScreens (clear + render + dirty-page flush)\n");
+  parseStats(JSON_PACKET, sizeof(JSON_PACKET) - 1, BENCH_IP);
+  updateHostPages(millis());
+  publishSnapshot();
+  readSnapshot();
+  benchScreen("stats, unchanged", iterations, [](int) { displayStats(); });
+  benchScreen("stats, new packet each frame", iterations, [](int i) {
+    binary_packet[8] = i & 0xFF;  // cpu_percent moves
+    parseStats((const char*)binary_packet, sizeof(binary_packet), BENCH_IP);
+    publishSnapshot();
+    readSnapshot();
+    displayStats();
+  });
+  benchScreen("stats, easing between packets", iterations, [](int i) {
+    if (i % 75 == 0) {  // A packet every 3 s at 25 fps
+      binary_packet[8] = (i / 75 * 97) & 0xFF;
+      parseStats((const char*)binary_packet, sizeof(binary_packet), BENCH_IP);
+      publishSnapshot();
+      readSnapshot();
+    }
+    mockAdvanceMillis(40);
+    displayStats();
+  });
+  benchScreen("history graphs, new packet", iterations, [](int i) {
+    binary_packet[8] = i & 0xFF;
+    parseStats((const char*)binary_packet, sizeof(binary_packet), BENCH_IP);
+    publishSnapshot();
+    readSnapshot();
+    displayHistory();
+  });
+  benchScreen("per-core bars (32), new packet", iterations, [](int i) {
+    cores_packet[STATS_PACKET_SIZE + 1 + (i & 31)] = i % 201;
+    parseStats((const char*)cores_packet, sizeof(cores_packet), BENCH_IP);
+    publishSnapshot();
+    readSnapshot();
+    displayCores();
+  });
+  benchScreen("standard clock", iterations, [](int) {
+    mockAdvanceMillis(1000);
+    displayStandardClock();
+  });
+  benchScreen("large clock", iterations, [](int) {
+    mockAdvanceMillis(1000);
+    displayLargeClock();
+  });
+  mockSetEpoch(BENCH_EPOCH - 15);  // Second 05: Mario idle
+  mockSetMillis(0);
+  benchScreen("mario clock, idle", iterations, [](int) { displayClockWithMario(); });
+  benchScreen("mario clock, animating", iterations, [](int) {
+    stayInMarioWindow();
+    displayClockWithMario();
+  });
+
+  printf("\nDraw primitives (render only)\n");
+  report("drawTimeWithBounce", measure(iterations, [](int) {
+    display.clearDisplay();
+    drawTimeWithBounce();
+  }), "call");
+  report("drawMario walking", measure(iterations, [](int i) {
+    display.clearDisplay();
+    drawMario(20 + (i & 63), 62, true, i & 1, false);
+  }), "call");
+  report("drawMario jumping", measure(iterations, [](int i) {
+    display.clearDisplay();
+    drawMario(20 + (i & 63), 50, true, 0, true);
+  }), "call");
+
+  report("snapshot publish + read", measure(iterations, [](int) {
+    publishSnapshot();
+    readSnapshot();
+  }), "call");
+
+  printf("\nFlush\n");
+  report("full display.display()", measure(iterations, [](int) { display.display(); }), "frame");
+  report("DisplayFlush, nothing changed", measure(iterations, [](int) { displayFlush.flush(); }), "frame");
+
+  printf("\nWeb (full request through HttpServer::poll())\n");
+  std::string etag = responseHeader(httpRequest("GET / HTTP/1.1\r\n\r\n"), "ETag");
+  report("GET /", measure(iterations, [](int) {
+    httpRequest("GET / HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n");
+  }), "req");
+  std::string cached = "GET / HTTP/1.1\r\nIf-None-Match: " + etag + "\r\n\r\n";
+  report("GET /, ETag matches (304)", measure(iterations, [&](int) { httpRequest(cached); }), "req");
+  report("GET /api/settings", measure(iterations, [](int) {
+    httpRequest("GET /api/settings HTTP/1.1\r\n\r\n");
+  }), "req");
+  report("GET /metrics", measure(iterations, [](int) {
+    httpRequest("GET /metrics HTTP/1.1\r\n\r\n");
+  }), "req");
+
+  return 0;
+}
@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""
+Compare the CPU cost per packet of pcmon-collector and linux_pc_stats_monitor.py.
+
+Runs each sender flat out (--interval 0) for a short and a long run and
+reports the difference divided by the extra packets, so interpreter start-up,
+sensor detection and the first sleep cancel out. Counters come from
+`perf stat` when it is installed, otherwise from the child's rusage (CPU
+time, page faults, context switches). Packets go to 127.0.0.1:4210, where a
+socket that is never read swallows them.
+
+    make -C collector && python3 collector/bench.py --short 200 --long 5200
+"""
+
+import argparse
+import os
+import shutil
+import socket
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(HERE)
+UDP_PORT = 4210
+PERF_EVENTS = "task-clock,instructions,cycles,page-faults,context-switches"
+
+
+def senders(json):
+    native = [os.path.join(HERE, "pcmon-collector"), "--interval", "0"]
+    python = [sys.executable, os.path.join(ROOT, "linux_pc_stats_monitor.py"),
+              "--ip", "127.0.0.1", "--interval", "0", "--quiet"]
+    if json:
+        native.append("--json")
+    else:
+        python.append("--binary")
+    return {"pcmon-collector": lambda n: native + ["--count", str(n), "127.0.0.1"],
+            "python sender": lambda n: python + ["--count", str(n)]}
+
+
+def run_perf(cmd):
+    with tempfile.NamedTemporaryFile("r", suffix=".csv") as out:
+        subprocess.run(["perf", "stat", "-x,", "-e", PERF_EVENTS, "-o", out.name, "--"] + cmd,
+                       stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, check=True)
+        counters = {}
+        for line in out:
+            fields = line.strip().split(",")
+            if len(fields) < 3 or not fields[0] or fields[0].startswith("<"):
+                continue  # Comment, blank or <not supported>
+            name = fields[2].split(":")[0]
+            value = float(fields[0])
+            counters["cpu us" if name == "task-clock" else name] = value * 1e3 if name == "task-clock" else value
+        return counters
+
+
+def run_rusage(cmd):
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    _, status, ru = os.wait4(proc.pid, 0)
+    if status:
+        raise subprocess.CalledProcessError(status, cmd)
+    return {"cpu us": (ru.ru_utime + ru.ru_stime) * 1e6,
+            "user us": ru.ru_utime * 1e6,
+            "sys us": ru.ru_stime * 1e6,
+            "page-faults": ru.ru_minflt + ru.ru_majflt,
+            "context-switches": ru.ru_nvcsw + ru.ru_nivcsw}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--short", type=int, default=200, help="packets in the short run")
+    parser.add_argument("--long", type=int, default=5200, help="packets in the long run")
+    parser.add_argument("--json", action="store_true", help="compare the JSON payloads instead")
+    parser.add_argument("--rusage", action="store_true", help="ignore perf even if installed")
+    args = parser.parse_args()
+
+    if not os.access(os.path.join(HERE, "pcmon-collector"), os.X_OK):
+        sys.exit("build it first: make -C collector")
+    perf = shutil.which("perf") and not args.rusage
+    run = run_perf if perf else run_rusage
+    print("counters from %s, %s payload, %d - %d packets" % (
+        "perf stat" if perf else "rusage", "JSON" if args.json else "binary", args.long, args.short))
+
+    sink = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    try:
+        sink.bind(("127.0.0.1", UDP_PORT))
+    except OSError:
+        pass  # Something else is listening already; it gets the packets
+
+    results = {}
+    for name, cmd in senders(args.json).items():
+        short, long = run(cmd(args.short)), run(cmd(args.long))
+        extra = args.long - args.short
+        results[name] = {k: (long[k] - short[k]) / extra for k in long if k in short}
+    sink.close()
+
+    names = list(results)
+    print("%-18s" % "per packet" + "".join("%18s" % n for n in names))
+    for key in results[names[0]]:
+        print("%-18s" % key + "".join("%18.2f" % results[n].get(key, 0) for n in names))
+    native, python = (results[n]["cpu us"] for n in names)
+    if native > 0:
+        print("python sender uses %.0fx the CPU per packet" % (python / native))
+
+
+if __name__ == "__main__":
+    main()
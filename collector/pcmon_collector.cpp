@@ -0,0 +1,573 @@
+/*
+ * pcmon-collector - native Linux stats sender for headless hosts
+ *
+ * Sends the same packet as linux_pc_stats_monitor.py --binary (see
+ * include/StatsProtocol.h), or its JSON with --json, to UDP port 4210.
+ *
+ * Everything it reads is opened once at startup: /proc/stat, /proc/meminfo,
+ * the hwmon sensors detect_hwmon_sensors() would pick (k10temp/zenpower
+ * CPU temperature, amdgpu temperature, the first fan) and the UDP socket,
+ * connected to the display. Each sample is then a handful of pread()s into
+ * stack buffers and one send(), plus a statvfs() every 30 s: no heap
+ * allocation, no process spawned, nothing opened. There is no NVIDIA
+ * support (that needs nvidia-smi); use the Python sender on machines that
+ * have one.
+ *
+ *   pcmon-collector [options] <ESP32 IP>
+ *     --interval SEC   seconds between packets (default 3, 0.5 with --delta)
+ *     --count N        stop after N packets (default: run forever)
+ *     --host-id N      host ID for displays shared by several PCs
+ *     --json           send JSON instead of the binary packet
+ *     --delta          binary keyframes every 10 s, and in between only the
+ *                      fields that moved past their deadband
+ *     --cores          add per-core load (up to 64 cores) for the per-core page
+ *     --disk PATH      filesystem for disk usage (default /)
+ *     --profile        print CPU time per sample every 20 packets
+ */
+
+#include <arpa/inet.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <netinet/in.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/statvfs.h>
+#include <time.h>
+#include <unistd.h>
+#include "StatsProtocol.h"
+
+static const int UDP_PORT = 4210;
+static const int PROFILE_EVERY = 20;
+static const int DISK_INTERVAL = 30;  // s, like the Python sender
+static const double DELTA_INTERVAL = 0.5;  // s, default send period with --delta
+static const uint32_t KEYFRAME_INTERVAL_MS = 10000;
+
+static volatile sig_atomic_t stop_requested = 0;
+
+// ========== Persistent Files ==========
+
+// A sysfs/procfs file opened once and re-read from offset 0 each time
+struct PreadFile {
+  int fd = -1;
+  char path[320] = {};
+
+  bool open(const char* p) {
+    snprintf(path, sizeof(path), "%s", p);
+    fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    return fd >= 0;
+  }
+
+  // NUL-terminated contents in buf, or -1
+  ssize_t read(char* buf, size_t cap) {
+    if (fd < 0) return -1;
+    ssize_t n = pread(fd, buf, cap - 1, 0);
+    if (n < 0) return -1;
+    buf[n] = '\0';
+    return n;
+  }
+
+  // Integer value (hwmon inputs), or `fallback`
+  long readLong(long fallback) {
+    char buf[32];
+    if (read(buf, sizeof(buf)) <= 0) return fallback;
+    char* end;
+    long v = strtol(buf, &end, 10);
+    return end == buf ? fallback : v;
+  }
+};
+
+// ========== Sensors ==========
+
+struct Sensors {
+  PreadFile cpu_temp;
+  PreadFile gpu_temp;
+  PreadFile fan;
+};
+
+static bool fileExists(const char* path) {
+  return access(path, R_OK) == 0;
+}
+
+// Same choices as detect_hwmon_sensors() in linux_pc_stats_monitor.py
+static void detectSensors(Sensors& s) {
+  DIR* dir = opendir("/sys/class/hwmon");
+  if (!dir) {
+    fprintf(stderr, "no /sys/class/hwmon, temperatures and fan unavailable\n");
+    return;
+  }
+  while (struct dirent* entry = readdir(dir)) {
+    if (entry->d_name[0] == '.') continue;
+    char base[300], path[320], name[64] = {};
+    snprintf(base, sizeof(base), "/sys/class/hwmon/%s", entry->d_name);
+    snprintf(path, sizeof(path), "%s/name", base);
+    PreadFile name_file;
+    if (!name_file.open(path)) continue;
+    name_file.read(name, sizeof(name));
+    close(name_file.fd);
+    name[strcspn(name, "\n")] = '\0';
+
+    if ((strcmp(name, "k10temp") == 0 || strcmp(name, "zenpower") == 0) && s.cpu_temp.fd < 0) {
+      static const char* const inputs[] = {"temp1_input", "temp2_input"};
+      for (const char* input : inputs) {
+        snprintf(path, sizeof(path), "%s/%s", base, input);
+        if (fileExists(path) && s.cpu_temp.open(path)) break;
+      }
+    }
+    if (strcmp(name, "amdgpu") == 0 && s.gpu_temp.fd < 0) {
+      snprintf(path, sizeof(path), "%s/temp1_input", base);
+      if (fileExists(path)) s.gpu_temp.open(path);
+    }
+    if (s.fan.fd < 0) {
+      for (int i = 1; i <= 9; i++) {
+        snprintf(path, sizeof(path), "%s/fan%d_input", base, i);
+        if (fileExists(path) && s.fan.open(path)) break;
+      }
+    }
+  }
+  closedir(dir);
+
+  fprintf(stderr, "CPU temp: %s\nGPU temp: %s\nFan:      %s\n",
+          s.cpu_temp.fd >= 0 ? s.cpu_temp.path : "-", s.gpu_temp.fd >= 0 ? s.gpu_temp.path : "-",
+          s.fan.fd >= 0 ? s.fan.path : "-");
+}
+
+// ========== Sampling ==========
+
+struct Sample {
+  bool have_cpu = false;
+  float cpu_percent = 0;
+  bool have_mem = false;
+  float ram_percent = 0;
+  float ram_used_gb = 0;
+  float ram_total_gb = 0;
+  bool have_disk = false;
+  float disk_percent = 0;
+  long cpu_temp = -1;   // deg C, -1 = none
+  long gpu_temp = -1;
+  long fan_speed = -1;  // RPM
+  int core_count = 0;   // 0 = none (or --cores off)
+  uint8_t cores[STATS_MAX_CORES];  // 0.5 % steps, 0-200
+};
+
+struct Collector {
+  PreadFile proc_stat;
+  PreadFile proc_meminfo;
+  Sensors sensors;
+  const char* disk_path = "/";
+  bool have_disk = false;
+  float disk_percent = 0;
+  time_t next_disk = 0;
+  unsigned long long last_idle = 0;
+  unsigned long long last_total = 0;
+  bool cores = false;  // --cores
+  int core_count = 0;
+  unsigned long long core_idle[STATS_MAX_CORES] = {};
+  unsigned long long core_total[STATS_MAX_CORES] = {};
+};
+
+// Idle and total jiffies of a "cpu"/"cpuN" line; `p` starts past the label
+// and is left past the fields used
+static void cpuTimes(char*& p, unsigned long long& idle, unsigned long long& total) {
+  unsigned long long v[8] = {};
+  for (int i = 0; i < 8; i++) v[i] = strtoull(p, &p, 10);
+  idle = v[3] + v[4];  // idle + iowait
+  total = 0;
+  for (unsigned long long x : v) total += x;  // guest is already in user/nice
+}
+
+// Busy share of one core since the previous call, in 0.5 % steps
+static uint8_t coreLoad(unsigned long long idle, unsigned long long total,
+                        unsigned long long last_idle, unsigned long long last_total) {
+  long x = lroundf(200.0f * (1.0f - (float)(idle - last_idle) / (float)(total - last_total)));
+  return (uint8_t)(x < 0 ? 0 : x > 200 ? 200 : x);
+}
+
+// Aggregate "cpu" line: busy share since the previous call; with --cores
+// also the "cpuN" lines right after it, into s.cores
+static bool sampleCpu(Collector& c, Sample& s) {
+  char buf[8192];  // ~100 bytes per core line; 256 covers the aggregate alone
+  if (c.proc_stat.read(buf, c.cores ? sizeof(buf) : 256) <= 0 || strncmp(buf, "cpu ", 4) != 0) {
+    return false;
+  }
+  char* p = buf + 4;
+  unsigned long long idle, total;
+  cpuTimes(p, idle, total);
+
+  bool ok = c.last_total != 0 && total > c.last_total;
+  if (ok) {
+    s.cpu_percent = 100.0f * (1.0f - (float)(idle - c.last_idle) / (float)(total - c.last_total));
+  }
+  c.last_idle = idle;
+  c.last_total = total;
+
+  int n = 0;
+  bool cores_ok = true;
+  for (char* line = c.cores ? strchr(p, '\n') : nullptr;
+       line && strncmp(line + 1, "cpu", 3) == 0 && n < STATS_MAX_CORES; line = strchr(p, '\n')) {
+    p = line + 4;
+    strtoul(p, &p, 10);  // Core number
+    cpuTimes(p, idle, total);
+    if (n < c.core_count && total > c.core_total[n]) {
+      s.cores[n] = coreLoad(idle, total, c.core_idle[n], c.core_total[n]);
+    } else {
+      cores_ok = false;  // New core, or no time passed
+    }
+    c.core_idle[n] = idle;
+    c.core_total[n] = total;
+    n++;
+  }
+  s.core_count = cores_ok && n == c.core_count ? n : 0;
+  c.core_count = n;
+  return ok;
+}
+
+// Value in kB of "Name:" in /proc/meminfo text, or -1
+static long long meminfoValue(const char* text, const char* name) {
+  size_t len = strlen(name);
+  for (const char* line = text; line && *line; line = strchr(line, '\n'), line = line ? line + 1 : nullptr) {
+    if (strncmp(line, name, len) == 0 && line[len] == ':') return strtoll(line + len + 1, nullptr, 10);
+  }
+  return -1;
+}
+
+// Same formulas as psutil.virtual_memory() (and the Python sender)
+static bool sampleMemory(Collector& c, Sample& s) {
+  char buf[4096];
+  if (c.proc_meminfo.read(buf, sizeof(buf)) <= 0) return false;
+  long long total = meminfoValue(buf, "MemTotal");
+  if (total <= 0) return false;
+  long long free_kb = meminfoValue(buf, "MemFree");
+  long long buffers = meminfoValue(buf, "Buffers");
+  long long cached = meminfoValue(buf, "Cached") + meminfoValue(buf, "SReclaimable");
+  long long available = meminfoValue(buf, "MemAvailable");
+  if (available < 0) available = free_kb + buffers + cached;
+  long long used = total - free_kb - buffers - cached;
+  if (used < 0) used = total - free_kb;
+
+  const float gb = 1024.0f * 1024.0f;  // kB
+  s.ram_percent = 100.0f * (float)(total - available) / (float)total;
+  s.ram_used_gb = used / gb;
+  s.ram_total_gb = total / gb;
+  return true;
+}
+
+static bool sampleDisk(const char* path, float& percent) {
+  struct statvfs st;
+  if (statvfs(path, &st) != 0) return false;
+  unsigned long long used = (unsigned long long)(st.f_blocks - st.f_bfree) * st.f_frsize;
+  unsigned long long total = used + (unsigned long long)st.f_bavail * st.f_frsize;
+  if (total == 0) return false;
+  percent = 100.0f * used / total;
+  return true;
+}
+
+static void sample(Collector& c, Sample& s) {
+  s = Sample();
+  s.have_cpu = sampleCpu(c, s);
+  s.have_mem = sampleMemory(c, s);
+  time_t now = time(nullptr);
+  if (now >= c.next_disk) {
+    c.have_disk = sampleDisk(c.disk_path, c.disk_percent);
+    c.next_disk = now + DISK_INTERVAL;
+  }
+  s.have_disk = c.have_disk;
+  s.disk_percent = c.disk_percent;
+  long t = c.sensors.cpu_temp.readLong(-1000000);
+  if (t > -1000000) s.cpu_temp = t / 1000;
+  t = c.sensors.gpu_temp.readLong(-1000000);
+  if (t > -1000000) s.gpu_temp = t / 1000;
+  s.fan_speed = c.sensors.fan.readLong(-1);
+}
+
+// ========== Encoding ==========
+
+// --delta: the values the display has, so only fields that moved past
+// their deadband (in wire units, same as the Python sender) go out
+struct DeltaState {
+  bool have = false;
+  bool keyframe_wanted = false;  // The display asked for one
+  uint32_t keyframe_at = 0;      // monotonicMs() of the next keyframe
+  StatsWire sent = {};
+};
+
+static const int DEADBAND_PERCENT = 10;  // 1 %
+static const int DEADBAND_RAM = 5;       // 0.5 %
+static const int DEADBAND_GB = 1;        // 0.1 GB
+static const int DEADBAND_DISK = 5;      // 0.5 %
+static const int DEADBAND_TEMP = 1;      // deg C
+static const int DEADBAND_FAN = 50;      // RPM
+static const int DEADBAND_CORE = 4;      // 2 %, any one core
+
+template <typename T>
+static void deltaField(const StatsWire& w, uint16_t field, T value, T& sent, int deadband,
+                       uint16_t& changed) {
+  if ((w.present & field) && abs((int)value - (int)sent) >= deadband) {
+    sent = value;
+    changed |= field;
+  }
+}
+
+// Per-core block of a delta: all cores if any one moved past the deadband
+static void deltaCores(StatsWire& w, StatsWire& sent) {
+  if (!(w.flags & STATS_FLAG_CORES)) return;
+  for (int i = 0; i < w.core_count; i++) {
+    if (abs((int)w.cores[i] - (int)sent.cores[i]) >= DEADBAND_CORE) {
+      memcpy(sent.cores, w.cores, w.core_count);
+      return;
+    }
+  }
+  w.flags &= ~STATS_FLAG_CORES;
+}
+
+// Turns `w` into a delta unless a keyframe is due, asked for, or a field
+// appeared or disappeared (a delta can't say "null")
+static void applyDelta(DeltaState& d, StatsWire& w) {
+  if (!d.have || d.keyframe_wanted || (int32_t)(w.send_ms - d.keyframe_at) >= 0 ||
+      w.present != d.sent.present || w.core_count != d.sent.core_count) {
+    d.sent = w;
+    d.have = true;
+    d.keyframe_wanted = false;
+    d.keyframe_at = w.send_ms + KEYFRAME_INTERVAL_MS;
+    return;
+  }
+  StatsWire& sent = d.sent;
+  uint16_t changed = 0;
+  deltaField(w, STATS_FIELD_CPU_PERCENT, w.cpu_percent_x10, sent.cpu_percent_x10, DEADBAND_PERCENT, changed);
+  deltaField(w, STATS_FIELD_RAM_PERCENT, w.ram_percent_x10, sent.ram_percent_x10, DEADBAND_RAM, changed);
+  deltaField(w, STATS_FIELD_RAM_USED, w.ram_used_x10, sent.ram_used_x10, DEADBAND_GB, changed);
+  deltaField(w, STATS_FIELD_RAM_TOTAL, w.ram_total_x10, sent.ram_total_x10, DEADBAND_GB, changed);
+  deltaField(w, STATS_FIELD_DISK_PERCENT, w.disk_percent_x10, sent.disk_percent_x10, DEADBAND_DISK, changed);
+  deltaField(w, STATS_FIELD_CPU_TEMP, w.cpu_temp, sent.cpu_temp, DEADBAND_TEMP, changed);
+  deltaField(w, STATS_FIELD_GPU_TEMP, w.gpu_temp, sent.gpu_temp, DEADBAND_TEMP, changed);
+  deltaField(w, STATS_FIELD_FAN_SPEED, w.fan_speed, sent.fan_speed, DEADBAND_FAN, changed);
+  if (w.hour != sent.hour || w.minute != sent.minute) {
+    sent.hour = w.hour;
+    sent.minute = w.minute;
+    changed |= STATS_FIELD_TIMESTAMP;
+  }
+  deltaCores(w, sent);
+  w.flags |= STATS_FLAG_DELTA;
+  w.present = changed;
+}
+
+// True if the display asked for a keyframe since the last call
+static bool keyframeRequested(int sock) {
+  bool asked = false;
+  uint8_t buf[16];
+  ssize_t n;
+  while ((n = recv(sock, buf, sizeof(buf), MSG_DONTWAIT)) >= 0) {
+    if (statsIsKeyframeRequest(buf, n)) asked = true;
+  }
+  return asked;
+}
+
+static uint16_t fixed10(float v) {
+  long x = lroundf(v * 10);
+  return (uint16_t)(x < 0 ? 0 : x > 65535 ? 65535 : x);
+}
+
+static int8_t clampTemp(long v) {
+  return (int8_t)(v < -128 ? -128 : v > 127 ? 127 : v);
+}
+
+static uint32_t monotonicMs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(ts.tv_sec * 1000ULL + ts.tv_nsec / 1000000);
+}
+
+static size_t encodeBinary(const Sample& s, uint16_t seq, uint8_t host_id, const struct tm& now,
+                           DeltaState* delta, uint8_t* buf, size_t cap) {
+  StatsWire w = {};
+  w.version = STATS_PROTOCOL_VERSION;
+  w.flags = STATS_FLAG_SEND_TIME | (host_id ? STATS_FLAG_HOST_ID : 0);
+  w.seq = seq;
+  w.present = STATS_FIELD_TIMESTAMP;
+  if (s.have_cpu) {
+    w.present |= STATS_FIELD_CPU_PERCENT;
+    w.cpu_percent_x10 = fixed10(s.cpu_percent);
+  }
+  if (s.have_mem) {
+    w.present |= STATS_FIELD_RAM_PERCENT | STATS_FIELD_RAM_USED | STATS_FIELD_RAM_TOTAL;
+    w.ram_percent_x10 = fixed10(s.ram_percent);
+    w.ram_used_x10 = fixed10(s.ram_used_gb);
+    w.ram_total_x10 = fixed10(s.ram_total_gb);
+  }
+  if (s.have_disk) {
+    w.present |= STATS_FIELD_DISK_PERCENT;
+    w.disk_percent_x10 = fixed10(s.disk_percent);
+  }
+  if (s.cpu_temp >= 0) {
+    w.present |= STATS_FIELD_CPU_TEMP;
+    w.cpu_temp = clampTemp(s.cpu_temp);
+  }
+  if (s.gpu_temp >= 0) {
+    w.present |= STATS_FIELD_GPU_TEMP;
+    w.gpu_temp = clampTemp(s.gpu_temp);
+  }
+  if (s.fan_speed >= 0) {
+    w.present |= STATS_FIELD_FAN_SPEED;
+    w.fan_speed = (uint16_t)(s.fan_speed > 65535 ? 65535 : s.fan_speed);
+  }
+  w.hour = now.tm_hour;
+  w.minute = now.tm_min;
+  if (s.core_count > 0) {
+    w.flags |= STATS_FLAG_CORES;
+    w.core_count = s.core_count;
+    memcpy(w.cores, s.cores, s.core_count);
+  }
+  w.host_id = host_id;
+  w.send_ms = monotonicMs();
+  if (delta) applyDelta(*delta, w);
+  return statsWireEncode(w, buf, cap);
+}
+
+// Appends `"key": value, ` (or null) to buf
+static int jsonField(char* buf, size_t cap, int len, const char* key, bool have, double value,
+                     int decimals) {
+  if (len < 0 || (size_t)len >= cap) return len;
+  int n = have ? snprintf(buf + len, cap - len, "\"%s\": %.*f, ", key, decimals, value)
+               : snprintf(buf + len, cap - len, "\"%s\": null, ", key);
+  return len + n;
+}
+
+static size_t encodeJson(const Sample& s, uint16_t seq, uint8_t host_id, const struct tm& now,
+                         char* buf, size_t cap) {
+  int len = snprintf(buf, cap, "{\"seq\": %u, \"send_ms\": %u, \"timestamp\": \"%02d:%02d\", ",
+                     seq, monotonicMs(), now.tm_hour, now.tm_min);
+  len = jsonField(buf, cap, len, "cpu_percent", s.have_cpu, s.cpu_percent, 1);
+  len = jsonField(buf, cap, len, "ram_percent", s.have_mem, s.ram_percent, 1);
+  len = jsonField(buf, cap, len, "ram_used_gb", s.have_mem, s.ram_used_gb, 1);
+  len = jsonField(buf, cap, len, "ram_total_gb", s.have_mem, s.ram_total_gb, 1);
+  len = jsonField(buf, cap, len, "disk_percent", s.have_disk, s.disk_percent, 1);
+  len = jsonField(buf, cap, len, "cpu_temp", s.cpu_temp >= 0, s.cpu_temp, 0);
+  len = jsonField(buf, cap, len, "gpu_temp", s.gpu_temp >= 0, s.gpu_temp, 0);
+  len = jsonField(buf, cap, len, "fan_speed", s.fan_speed >= 0, s.fan_speed, 0);
+  if (s.core_count > 0 && len > 0 && (size_t)len < cap) {
+    len += snprintf(buf + len, cap - len, "\"cpu_cores\": [");
+    for (int i = 0; i < s.core_count && (size_t)len < cap; i++) {
+      len += snprintf(buf + len, cap - len, i ? ", %d" : "%d", (s.cores[i] + 1) / 2);
+    }
+    if ((size_t)len < cap) len += snprintf(buf + len, cap - len, "], ");
+  }
+  if (host_id && (size_t)len < cap) len += snprintf(buf + len, cap - len, "\"host_id\": %u, ", host_id);
+  if ((size_t)len < cap) len += snprintf(buf + len, cap - len, "\"status\": \"online\"}");
+  return (len > 0 && (size_t)len < cap) ? len : 0;
+}
+
+// ========== Main ==========
+
+static double threadCpuSeconds() {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void onSignal(int) {
+  stop_requested = 1;
+}
+
+static int usage(const char* argv0) {
+  fprintf(stderr,
+          "usage: %s [--interval SEC] [--count N] [--host-id N] [--json | --delta] [--cores] "
+          "[--disk PATH] [--profile] <ESP32 IP>\n", argv0);
+  return 2;
+}
+
+int main(int argc, char** argv) {
+  double interval = -1;
+  long count = -1;
+  int host_id = 0;
+  bool json = false;
+  bool use_delta = false;
+  bool profile = false;
+  const char* ip = nullptr;
+  Collector c;
+
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    bool has_value = i + 1 < argc;
+    if (strcmp(arg, "--interval") == 0 && has_value) interval = atof(argv[++i]);
+    else if (strcmp(arg, "--count") == 0 && has_value) count = atol(argv[++i]);
+    else if (strcmp(arg, "--host-id") == 0 && has_value) host_id = atoi(argv[++i]);
+    else if (strcmp(arg, "--disk") == 0 && has_value) c.disk_path = argv[++i];
+    else if (strcmp(arg, "--json") == 0) json = true;
+    else if (strcmp(arg, "--delta") == 0) use_delta = true;
+    else if (strcmp(arg, "--cores") == 0) c.cores = true;
+    else if (strcmp(arg, "--profile") == 0) profile = true;
+    else if (arg[0] != '-' && !ip) ip = arg;
+    else return usage(argv[0]);
+  }
+  if (interval < 0) interval = use_delta ? DELTA_INTERVAL : 3;
+  if (!ip || host_id < 0 || host_id > 255 || (json && use_delta)) return usage(argv[0]);
+
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(UDP_PORT);
+  if (inet_pton(AF_INET, ip, &addr.sin_addr) != 1) {
+    fprintf(stderr, "bad IPv4 address: %s\n", ip);
+    return 2;
+  }
+  int sock = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+  if (sock < 0 || connect(sock, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+    perror("socket");
+    return 1;
+  }
+
+  if (!c.proc_stat.open("/proc/stat") || !c.proc_meminfo.open("/proc/meminfo")) {
+    perror("/proc");
+    return 1;
+  }
+  detectSensors(c.sensors);
+
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+
+  Sample s;
+  sample(c, s);  // Baseline for the first CPU load
+  struct timespec pause = {(time_t)interval, (long)((interval - (time_t)interval) * 1e9)};
+  if (interval > 0) nanosleep(&pause, nullptr);
+
+  DeltaState delta;
+  uint16_t seq = 0;
+  double profile_cpu = 0;
+  int profile_count = 0;
+  for (long sent = 0; !stop_requested && (count < 0 || sent < count); sent++) {
+    double t0 = profile ? threadCpuSeconds() : 0;
+
+    sample(c, s);
+    if (use_delta && keyframeRequested(sock)) delta.keyframe_wanted = true;
+    time_t wall = time(nullptr);
+    struct tm now;
+    localtime_r(&wall, &now);
+    uint8_t packet[STATS_PACKET_MAX_SIZE];
+    char text[1024];  // ~250 bytes, plus up to 5 per core
+    size_t len = json ? encodeJson(s, seq, host_id, now, text, sizeof(text))
+                      : encodeBinary(s, seq, host_id, now, use_delta ? &delta : nullptr, packet,
+                                     sizeof(packet));
+    if (len > 0 && send(sock, json ? (const void*)text : (const void*)packet, len, 0) < 0 &&
+        errno != ECONNREFUSED) {  // Refused = nothing listening yet (display rebooting)
+      perror("send");
+    }
+    seq++;
+
+    if (profile) {
+      profile_cpu += threadCpuSeconds() - t0;
+      if (++profile_count == PROFILE_EVERY) {
+        fprintf(stderr, "[profile] %d packets: %.1f us CPU per sample + send\n", profile_count,
+                profile_cpu * 1e6 / profile_count);
+        profile_cpu = 0;
+        profile_count = 0;
+      }
+    }
+    if (interval > 0) nanosleep(&pause, nullptr);
+  }
+
+  close(sock);
+  return 0;
+}
@@ -0,0 +1,91 @@
+/*
+ * BigDigits - pre-rendered large clock digits for the SSD1306
+ *
+ * setTextSize(3) / setTextSize(4) make Adafruit GFX fill one S x S
+ * rectangle per lit font pixel, which is a few dozen fillRect() calls per
+ * digit. Here the digits 0-9 and ':' are scaled once, at compile time, into
+ * page-aligned column bitmaps (S bytes per column, bit 0 = top row, same as
+ * the panel RAM) and OR-ed into the framebuffer one byte column at a time
+ * by blitColumns() from Sprite.h, at any y including the digit-bounce
+ * offsets.
+ *
+ * Output is pixel-identical to print() with the built-in font and a
+ * transparent background.
+ */
+
+#ifndef BIG_DIGITS_H
+#define BIG_DIGITS_H
+
+#include <stdint.h>
+#include <Adafruit_SSD1306.h>
+#include "Sprite.h"
+
+// Columns of the classic 5x7 GFX font for '0'..'9' and ':'
+constexpr uint8_t BIG_DIGIT_FONT[11][5] = {
+  {0x3E, 0x51, 0x49, 0x45, 0x3E},  // 0
+  {0x00, 0x42, 0x7F, 0x40, 0x00},  // 1
+  {0x72, 0x49, 0x49, 0x49, 0x46},  // 2
+  {0x21, 0x41, 0x49, 0x4D, 0x33},  // 3
+  {0x18, 0x14, 0x12, 0x7F, 0x10},  // 4
+  {0x27, 0x45, 0x45, 0x45, 0x39},  // 5
+  {0x3C, 0x4A, 0x49, 0x49, 0x31},  // 6
+  {0x41, 0x21, 0x11, 0x09, 0x07},  // 7
+  {0x36, 0x49, 0x49, 0x49, 0x36},  // 8
+  {0x46, 0x49, 0x49, 0x29, 0x1E},  // 9
+  {0x00, 0x00, 0x14, 0x00, 0x00},  // :
+};
+
+template <int S>
+struct BigGlyphSet {
+  static constexpr int WIDTH = 5 * S;   // Lit columns
+  static constexpr int ADVANCE = 6 * S; // Cursor step, as print() does
+  static constexpr int PAGES = S;       // 8 * S rows
+  uint8_t columns[11][WIDTH * PAGES];   // [glyph][column * PAGES + page]
+};
+
+template <int S>
+constexpr BigGlyphSet<S> makeBigGlyphs() {
+  BigGlyphSet<S> set{};
+  for (int g = 0; g < 11; g++) {
+    for (int col = 0; col < 5 * S; col++) {
+      uint8_t src = BIG_DIGIT_FONT[g][col / S];
+      for (int page = 0; page < S; page++) {
+        uint8_t out = 0;
+        for (int bit = 0; bit < 8; bit++) {
+          if ((src >> ((page * 8 + bit) / S)) & 1) out |= 1 << bit;
+        }
+        set.columns[g][col * S + page] = out;
+      }
+    }
+  }
+  return set;
+}
+
+constexpr BigGlyphSet<3> BIG_DIGITS_3 = makeBigGlyphs<3>();
+constexpr BigGlyphSet<4> BIG_DIGITS_4 = makeBigGlyphs<4>();
+
+// Index into a BigGlyphSet, or -1 for characters it doesn't have
+inline int bigGlyphIndex(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c == ':') return 10;
+  return -1;
+}
+
+// OR one glyph into the framebuffer with its top-left corner at (x, y),
+// clipped to the screen
+template <int S>
+void blitBigGlyph(Adafruit_SSD1306& display, const BigGlyphSet<S>& set, char c, int x, int y) {
+  int g = bigGlyphIndex(c);
+  if (g < 0) return;
+  blitColumns(display, set.columns[g], set.WIDTH, set.PAGES, x, y);
+}
+
+// Like print(str) at setCursor(x, y) with setTextSize(S)
+template <int S>
+void blitBigString(Adafruit_SSD1306& display, const BigGlyphSet<S>& set, const char* str, int x, int y) {
+  for (; *str; str++, x += set.ADVANCE) {
+    blitBigGlyph(display, set, *str, x, y);
+  }
+}
+
+#endif
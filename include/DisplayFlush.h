@@ -0,0 +1,101 @@
+/*
+ * DisplayFlush - dirty-page I2C flush for the SSD1306
+ *
+ * Keeps a shadow copy of the last frame sent to the panel. On flush() each
+ * 8-row page is compared against the shadow and only the changed column
+ * windows are addressed and transmitted, instead of the full 1 KB frame
+ * that Adafruit_SSD1306::display() pushes every time.
+ *
+ * After start() the transfer runs on its own FreeRTOS task. flush() then
+ * only copies the finished frame (the back buffer, which is the display's
+ * own framebuffer) into a front buffer and returns; the task diffs and
+ * sends the front buffer while the caller draws the next frame. If the
+ * previous frame is still on the bus, flush() waits for it first, so the
+ * renderer is never more than one frame ahead. Without start() (and on
+ * the host build) flush() transfers synchronously.
+ *
+ * A frame can carry a tag through flush(); once that frame is on the panel
+ * the onFrameSent() hook gets the tag, from whichever task sent it.
+ */
+
+#ifndef DISPLAY_FLUSH_H
+#define DISPLAY_FLUSH_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_SSD1306.h>
+#include "FrameMetrics.h"
+#ifndef PCMON_NATIVE
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
+
+class DisplayFlush {
+public:
+  typedef void (*SentHook)(uint32_t tag);
+
+  static const uint8_t WIDTH = 128;
+  static const uint8_t PAGES = 8;
+
+  // Two changed runs closer than this are sent as one window; a new window
+  // costs about this many bytes of addressing overhead on the bus.
+  static const uint8_t MERGE_GAP = 10;
+
+  DisplayFlush(Adafruit_SSD1306& display, TwoWire& wire, uint8_t address = 0x3C,
+               uint32_t clock = 400000);
+
+  // Move transfers to a background task; call once, after display.begin()
+  void start(unsigned priority, uint32_t stack_size = 3072);
+
+  // Send every page whose contents differ from the last flushed frame.
+  // Returns the number of bytes clocked out on the bus, or 0 when the frame
+  // was handed to the background task. A non-zero tag is passed to the
+  // sent hook once the frame is out.
+  uint32_t flush(uint32_t tag = 0);
+
+  void onFrameSent(SentHook hook) { sent_hook = hook; }
+
+  // Forget the shadow so the next flush() sends the whole frame
+  void invalidate();
+
+  // Bus bytes per second over the last complete window (see RateCounter)
+  uint32_t bytesPerSecond() const { return byte_rate.perSecond(millis()); }
+
+  // Frames per second that reached the panel, over the same window
+  uint32_t framesPerSecond() const { return frame_rate.perSecond(millis()); }
+
+  uint32_t clockHz() const { return clock; }
+
+  uint32_t totalBytes() const { return total_bytes; }
+  uint32_t totalFlushes() const { return total_flushes; }
+
+private:
+  uint32_t sendFrame(const uint8_t* buffer, uint32_t tag);
+  uint32_t sendWindow(uint8_t page, uint8_t col_start, uint8_t col_end, const uint8_t* data);
+#ifndef PCMON_NATIVE
+  static void taskEntry(void* arg);
+#endif
+
+  Adafruit_SSD1306& display;
+  TwoWire& wire;
+  uint8_t address;
+  uint32_t clock;
+
+  uint8_t shadow[WIDTH * PAGES];
+  bool shadow_valid = false;
+  SentHook sent_hook = nullptr;
+
+#ifndef PCMON_NATIVE
+  uint8_t front[WIDTH * PAGES];      // Frame owned by the flush task
+  uint32_t front_tag = 0;
+  SemaphoreHandle_t front_ready = nullptr;  // Given by flush(), taken by the task
+  SemaphoreHandle_t front_free = nullptr;   // Given by the task when sent
+#endif
+
+  uint32_t total_bytes = 0;
+  uint32_t total_flushes = 0;
+  RateCounter byte_rate;
+  RateCounter frame_rate;
+};
+
+#endif
@@ -0,0 +1,128 @@
+/*
+ * FrameMetrics - cheap per-stage timing for loop()
+ *
+ * Each stage keeps its last SAMPLES durations (CPU cycles) in a ring, so
+ * record() is one store and an index bump and can stay on in production.
+ * min/avg/p50/p99/max are only computed when /metrics is scraped. The same
+ * ring holds microsecond latencies just as well as cycle counts.
+ *
+ * Each stat has one writing task but is read from the HTTP task, so both
+ * classes use the Seqlock protocol: readers copy and retry if a write
+ * overlapped, and the writer never waits.
+ */
+
+#ifndef FRAME_METRICS_H
+#define FRAME_METRICS_H
+
+#include <Arduino.h>
+#include <algorithm>
+#include <atomic>
+#include "Seqlock.h"
+
+class StageStats {
+public:
+  static const uint16_t SAMPLES = 128;
+
+  struct Summary {
+    uint32_t total;  // Samples ever recorded
+    uint32_t count;  // Samples in the window
+    uint32_t min;
+    uint32_t avg;
+    uint32_t p50;
+    uint32_t p99;
+    uint32_t max;
+  };
+
+  void record(uint32_t cycles) {
+    uint32_t s = seq.load(std::memory_order_relaxed);
+    seq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    samples[head] = cycles;
+    head = (head + 1) % SAMPLES;
+    if (filled < SAMPLES) filled++;
+    total++;
+    seq.store(s + 2, std::memory_order_release);
+  }
+
+  // Safe from any task
+  Summary summarize() const {
+    Summary s = {0, 0, 0, 0, 0, 0, 0};
+    uint32_t sorted[SAMPLES];
+    uint16_t n;
+    for (;;) {
+      uint32_t s0 = seq.load(std::memory_order_acquire);
+      if (s0 & 1) continue;
+      n = filled;
+      s.total = total;
+      memcpy(sorted, (const void*)samples, n * sizeof(uint32_t));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq.load(std::memory_order_relaxed) == s0) break;
+    }
+    if (n == 0) return s;
+
+    uint64_t sum = 0;
+    for (uint16_t i = 0; i < n; i++) sum += sorted[i];
+    std::sort(sorted, sorted + n);
+
+    s.count = n;
+    s.min = sorted[0];
+    s.avg = sum / n;
+    s.p50 = sorted[(n * 50 - 1) / 100];
+    s.p99 = sorted[(n * 99 - 1) / 100];
+    s.max = sorted[n - 1];
+    return s;
+  }
+
+private:
+  std::atomic<uint32_t> seq{0};
+  uint32_t samples[SAMPLES];
+  uint16_t head = 0;
+  uint16_t filled = 0;
+  uint32_t total = 0;
+};
+
+// Events (or bytes) per second over the last window of at least one
+// second. A window closes at the first add() after its second is up, so it
+// can run long; the count is divided by its actual length, not by 1 s.
+class RateCounter {
+public:
+  RateCounter() { published.write(window); }
+
+  void add(unsigned long now, uint32_t n) {
+    unsigned long elapsed = now - window.start;
+    if (elapsed >= 1000) {
+      window.last = rate(window.count, elapsed);
+      window.count = 0;
+      window.start = now;
+    }
+    window.count += n;
+    published.write(window);
+  }
+
+  void tick(unsigned long now) { add(now, 1); }
+
+  // Safe from any task. A window whose second is up but that no add() has
+  // closed yet counts as complete.
+  uint32_t perSecond(unsigned long now) const {
+    Window w;
+    published.read(w);
+    unsigned long elapsed = now - w.start;
+    return elapsed < 1000 ? w.last : rate(w.count, elapsed);
+  }
+
+private:
+  struct Window {
+    unsigned long start;
+    uint32_t count;
+    uint32_t last;
+  };
+
+  static uint32_t rate(uint32_t count, unsigned long elapsed) {
+    return (uint32_t)((uint64_t)count * 1000 / elapsed);
+  }
+
+  Window window = {0, 0, 0};  // Writer's copy
+  Seqlock<Window> published;
+};
+
+#endif
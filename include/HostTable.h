@@ -0,0 +1,111 @@
+/*
+ * HostTable - fixed-capacity, allocation-free map from a 64-bit key
+ * (sender address or host ID) to a per-host entry
+ *
+ * Lookups go through an open-addressing index twice the size of the table,
+ * so find/obtain cost the same no matter how many hosts are known. When the
+ * table is full, the least recently touched entry is evicted.
+ */
+
+#ifndef HOST_TABLE_H
+#define HOST_TABLE_H
+
+#include <stdint.h>
+#include <string.h>
+
+template <typename T, uint8_t N>
+class HostTable {
+public:
+  static const uint8_t CAPACITY = N;
+  static const uint8_t BUCKETS = 2 * N;
+  static_assert((BUCKETS & (BUCKETS - 1)) == 0, "capacity must be a power of two");
+
+  HostTable() {
+    memset(index, 0, sizeof(index));
+    memset(used, 0, sizeof(used));
+  }
+
+  // Entry for `key`, or nullptr if it is not in the table
+  T* find(uint64_t key) {
+    int slot = lookup(key);
+    return slot < 0 ? nullptr : &entries[slot];
+  }
+
+  // Entry for `key`, creating a zeroed one if needed. `onEvict` is called
+  // with the entry about to be reused when the table is full.
+  template <typename Evict>
+  T* obtain(uint64_t key, unsigned long now, Evict onEvict) {
+    int slot = lookup(key);
+    if (slot < 0) {
+      slot = freeSlot(now);
+      if (used[slot]) {
+        onEvict(entries[slot]);
+        unindex(keys[slot]);
+      }
+      keys[slot] = key;
+      used[slot] = true;
+      entries[slot] = T();
+      reindex(key, slot);
+    }
+    touched[slot] = now;
+    return &entries[slot];
+  }
+
+  T* obtain(uint64_t key, unsigned long now) {
+    return obtain(key, now, [](T&) {});
+  }
+
+  bool occupied(uint8_t slot) const { return used[slot]; }
+  T& at(uint8_t slot) { return entries[slot]; }
+  uint64_t keyAt(uint8_t slot) const { return keys[slot]; }
+
+private:
+  static uint8_t bucketOf(uint64_t key) {
+    return (uint8_t)((key * 0x9E3779B97F4A7C15ULL) >> 56) & (BUCKETS - 1);
+  }
+
+  int lookup(uint64_t key) const {
+    for (uint8_t i = 0, b = bucketOf(key); i < BUCKETS; i++, b = (b + 1) & (BUCKETS - 1)) {
+      if (index[b] == 0) return -1;
+      if (keys[index[b] - 1] == key) return index[b] - 1;
+    }
+    return -1;
+  }
+
+  uint8_t freeSlot(unsigned long now) const {
+    uint8_t oldest = 0;
+    for (uint8_t i = 0; i < N; i++) {
+      if (!used[i]) return i;
+      if (now - touched[i] > now - touched[oldest]) oldest = i;
+    }
+    return oldest;
+  }
+
+  void reindex(uint64_t key, uint8_t slot) {
+    uint8_t b = bucketOf(key);
+    while (index[b] != 0) b = (b + 1) & (BUCKETS - 1);
+    index[b] = slot + 1;
+  }
+
+  // Linear-probing delete with backward shift, so no tombstones build up
+  void unindex(uint64_t key) {
+    uint8_t b = bucketOf(key);
+    while (index[b] != 0 && keys[index[b] - 1] != key) b = (b + 1) & (BUCKETS - 1);
+    if (index[b] == 0) return;
+    index[b] = 0;
+    for (uint8_t next = (b + 1) & (BUCKETS - 1); index[next] != 0;
+         next = (next + 1) & (BUCKETS - 1)) {
+      uint8_t slot = index[next] - 1;
+      index[next] = 0;
+      reindex(keys[slot], slot);
+    }
+  }
+
+  T entries[N];
+  uint64_t keys[N];
+  unsigned long touched[N];
+  bool used[N];
+  uint8_t index[BUCKETS];  // slot + 1, 0 = empty bucket
+};
+
+#endif
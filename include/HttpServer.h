@@ -0,0 +1,174 @@
+/*
+ * HttpServer - small non-blocking HTTP server for the settings UI
+ *
+ * poll() never waits on a socket. Each call accepts pending connections,
+ * reads whatever has already arrived and writes at most TX_CHUNK bytes per
+ * connection, then returns, so a phone on weak Wi-Fi costs a few short
+ * passes instead of holding the task for the whole transfer. Writes are a
+ * non-blocking send(): WiFiClient::write() waits in select() (1 s, up to
+ * 10 times) while the peer's window is full, which would stall every other
+ * connection behind one slow client. A full window just means "next poll".
+ *
+ * Memory is fixed: at most MAX_CONNECTIONS are open, each with its own
+ * request and response buffers. A client beyond the cap gets a 503, a
+ * request that doesn't fit RX_BUFFER a 413, and a connection that makes no
+ * progress for IDLE_TIMEOUT ms is dropped. One request per connection.
+ *
+ * Handlers run inside poll() and fill an HttpResponse: text in the
+ * connection's buffer, a pointer to a static (flash) body, or a Filler that
+ * writes the body into the buffer one part at a time as the previous part
+ * goes out (sent without Content-Length; the close ends it). Static routes
+ * added with onStatic() are served gzipped to clients whose Accept-Encoding
+ * allows it and uncompressed otherwise, each copy with its own ETag, and
+ * answer a matching If-None-Match with 304.
+ */
+
+#ifndef HTTP_SERVER_H
+#define HTTP_SERVER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+enum HttpVerb { VERB_ANY, VERB_GET, VERB_HEAD, VERB_POST, VERB_OTHER };
+
+class HttpRequest {
+public:
+  HttpVerb verb = VERB_OTHER;
+  const char* path = "";  // Without the query string
+
+  // Header value, or nullptr; names are case-insensitive
+  const char* header(const char* name) const;
+
+  // Argument from the query string or an urlencoded form body
+  bool hasArg(const char* name) const;
+  // URL-decoded into `out` (truncated to size - 1); false if absent
+  bool arg(const char* name, char* out, size_t size) const;
+  long argInt(const char* name, long fallback) const;
+
+private:
+  friend class HttpServer;
+  const char* findArg(const char* name) const;
+
+  const char* headers = "";  // "Name: value\0\0" lines, up to headers_end
+  const char* headers_end = "";
+  const char* query = "";
+  const char* body = "";
+};
+
+class HttpResponse {
+public:
+  // Writes body part `part` (0, 1, ...) into buf; returns its length, 0 when done
+  typedef size_t (*Filler)(int part, char* buf, size_t cap);
+
+  // Buffer for a text body; send() with the number of bytes used
+  char* buffer() { return buf; }
+  size_t capacity() const { return cap; }
+
+  void send(int status, const char* type, size_t len);
+  void sendStatic(int status, const char* type, const uint8_t* data, size_t len);
+  // Body longer than the buffer, produced by `fill` part by part
+  void stream(int status, const char* type, Filler fill);
+
+  // Extra header, sent after the standard ones
+  void header(const char* name, const char* value);
+
+private:
+  friend class HttpServer;
+  char* buf = nullptr;
+  size_t cap = 0;
+  char extra[128] = {};   // Extra header lines
+  size_t extra_len = 0;
+
+  int status = 0;
+  const char* type = "text/plain";
+  const uint8_t* body = nullptr;
+  size_t body_len = 0;
+  Filler fill = nullptr;
+};
+
+class HttpServer {
+public:
+  typedef void (*Handler)(const HttpRequest& req, HttpResponse& res);
+
+  static constexpr uint8_t MAX_CONNECTIONS = 4;
+  static constexpr uint8_t MAX_ROUTES = 12;
+  static constexpr size_t RX_BUFFER = 1024;   // Request line + headers + body
+  static constexpr size_t TX_BUFFER = 1024;   // Text body, or one streamed part
+  static constexpr size_t HEAD_BUFFER = 384;  // Status line and headers
+  static constexpr size_t TX_CHUNK = 1024;    // Max bytes written per connection per poll()
+  static constexpr unsigned long IDLE_TIMEOUT = 5000;
+
+  explicit HttpServer(uint16_t port);
+
+  void on(const char* path, HttpVerb verb, Handler handler);
+  // Body in flash, pre-gzipped plus an uncompressed copy
+  void onStatic(const char* path, const char* type, const uint8_t* gzip, size_t gzip_len,
+                const char* gzip_etag, const uint8_t* raw, size_t raw_len, const char* raw_etag);
+
+  void begin();
+  // Drop every connection and stop listening; begin() again to rebind
+  void end();
+
+  // Service every connection once without blocking
+  void poll(unsigned long now);
+
+  uint8_t openConnections() const;
+  uint32_t totalRequests() const { return total_requests; }
+  uint32_t totalRejected() const { return total_rejected; }  // 413 / 503
+  uint32_t totalTimeouts() const { return total_timeouts; }
+
+private:
+  enum ConnState { CONN_FREE, CONN_READING, CONN_WRITING };
+
+  struct Connection {
+    WiFiClient client;
+    ConnState state = CONN_FREE;
+    unsigned long last_activity = 0;
+    size_t rx_len = 0;
+    size_t header_end = 0;      // Offset of the body, 0 until headers are in
+    size_t content_length = 0;
+    HttpRequest req;
+    size_t head_len = 0;   // Response status line + headers
+    size_t sent = 0;       // Bytes of head + body written so far
+    const uint8_t* body = nullptr;
+    size_t body_len = 0;
+    HttpResponse::Filler fill = nullptr;  // Streamed body: next part comes from here
+    int part = 0;
+    char rx[RX_BUFFER + 1];
+    char head[HEAD_BUFFER];
+    char tx[TX_BUFFER];
+  };
+
+  struct Route {
+    const char* path;
+    HttpVerb verb;
+    Handler handler;      // nullptr for a static route
+    const char* type;
+    const uint8_t* data;  // gzip
+    size_t len;
+    const char* etag;
+    const uint8_t* raw;
+    size_t raw_len;
+    const char* raw_etag;
+  };
+
+  void accept(unsigned long now);
+  void read(Connection& c, unsigned long now);
+  void write(Connection& c, unsigned long now);
+  bool parseHead(Connection& c, char* end);
+  void dispatch(Connection& c);
+  void respond(Connection& c, const HttpResponse& res, HttpVerb verb);
+  void reject(Connection& c, int status);
+  void close(Connection& c);
+
+  WiFiServer listener;
+  Connection conns[MAX_CONNECTIONS];
+  Route routes[MAX_ROUTES];
+  uint8_t route_count = 0;
+
+  uint32_t total_requests = 0;
+  uint32_t total_rejected = 0;
+  uint32_t total_timeouts = 0;
+};
+
+#endif
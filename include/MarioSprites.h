@@ -0,0 +1,63 @@
+/*
+ * MarioSprites - Mario's frames for the clock animation
+ *
+ * 8 x 9 px; drawMario(x, y) puts the top-left corner at (x - 4, y - 10).
+ * Left-facing frames are mirrored at compile time.
+ */
+
+#ifndef MARIO_SPRITES_H
+#define MARIO_SPRITES_H
+
+#include "Sprite.h"
+
+typedef Sprite<8, 9> MarioSprite;
+
+constexpr char MARIO_WALK_0_ROWS[9][9] = {
+  "..####..",
+  "..#####.",
+  "..####..",
+  "..#####.",
+  ".#####..",
+  "..####..",
+  "..####..",
+  "..####..",
+  "..####..",
+};
+
+constexpr char MARIO_WALK_1_ROWS[9][9] = {
+  "..####..",
+  "..#####.",
+  "..####..",
+  "..####..",
+  ".######.",
+  "..####..",
+  ".##..##.",
+  ".##..##.",
+  ".##..##.",
+};
+
+constexpr char MARIO_JUMP_ROWS[9][9] = {
+  "..####..",
+  "#.####.#",
+  ".######.",
+  "..####..",
+  "..####..",
+  "..####..",
+  "..####..",
+  "..####..",
+  "..####..",
+};
+
+constexpr MarioSprite MARIO_WALK_RIGHT[2] = {
+  spriteFromRows(MARIO_WALK_0_ROWS),
+  spriteFromRows(MARIO_WALK_1_ROWS),
+};
+
+constexpr MarioSprite MARIO_WALK_LEFT[2] = {
+  mirrored(MARIO_WALK_RIGHT[0]),
+  mirrored(MARIO_WALK_RIGHT[1]),
+};
+
+constexpr MarioSprite MARIO_JUMP = spriteFromRows(MARIO_JUMP_ROWS);
+
+#endif
@@ -0,0 +1,59 @@
+/*
+ * MetricHistory - fixed-size ring of quantized samples for one metric
+ *
+ * push() is O(1). Samples are read oldest first, so a sparkline is a single
+ * pass from 0 to size() - 1. max() is tracked on push; only when the
+ * largest sample falls out of the window does the next max() call rescan.
+ */
+
+#ifndef METRIC_HISTORY_H
+#define METRIC_HISTORY_H
+
+#include <stdint.h>
+
+template <typename T, uint16_t N = 128>
+class MetricHistory {
+public:
+  static const uint16_t CAPACITY = N;
+
+  void push(T value) {
+    if (count == N && samples[head] == peak) peak_stale = true;
+    samples[head] = value;
+    head = (head + 1) % N;
+    if (count < N) count++;
+
+    if (count == 1 || value >= peak) {
+      peak = value;
+      peak_stale = false;
+    }
+  }
+
+  uint16_t size() const { return count; }
+
+  // i = 0 is the oldest sample still held
+  T operator[](uint16_t i) const {
+    return samples[(head + N - count + i) % N];
+  }
+
+  T newest() const { return samples[(head + N - 1) % N]; }
+
+  T max() const {
+    if (peak_stale) {
+      peak = samples[0];
+      for (uint16_t i = 1; i < N; i++) {
+        if (samples[i] > peak) peak = samples[i];
+      }
+      peak_stale = false;
+    }
+    return peak;
+  }
+
+private:
+  T samples[N] = {};
+  uint16_t head = 0;
+  uint16_t count = 0;
+  mutable T peak = 0;
+  mutable bool peak_stale = false;
+};
+
+#endif
@@ -0,0 +1,62 @@
+/*
+ * NvsBlob - a POD struct stored as a single versioned, CRC-checked NVS value
+ *
+ * The struct is written with one putBytes() behind a small header holding
+ * a layout version, the struct size and a CRC-32 of the payload, and read
+ * back with one getBytes() into a stack buffer. A value that is missing,
+ * from another layout version or corrupted reads as "not there", so the
+ * caller can fall back to defaults or migrate an older layout.
+ */
+
+#ifndef NVS_BLOB_H
+#define NVS_BLOB_H
+
+#include <Preferences.h>
+#include <stdint.h>
+#include <string.h>
+
+template <typename T>
+struct NvsBlob {
+  uint16_t version;
+  uint16_t size;   // sizeof(T) when written
+  uint32_t crc;    // CRC-32 of value
+  T value;
+};
+
+// Bitwise CRC-32 (IEEE, reflected); a few hundred bytes at boot and on save.
+// Prefixed so it can't collide with zlib's or ROM crc32() in the same image.
+inline uint32_t nvsCrc32(const void* data, size_t len) {
+  const uint8_t* p = (const uint8_t*)data;
+  uint32_t crc = 0xFFFFFFFF;
+  while (len--) {
+    crc ^= *p++;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+// True and `out` filled if `key` holds a valid blob of this version
+template <typename T>
+bool loadNvsBlob(Preferences& prefs, const char* key, uint16_t version, T& out) {
+  NvsBlob<T> blob;
+  if (prefs.getBytes(key, &blob, sizeof(blob)) != sizeof(blob)) return false;
+  if (blob.version != version || blob.size != sizeof(T)) return false;
+  if (blob.crc != nvsCrc32(&blob.value, sizeof(T))) return false;
+  memcpy(&out, &blob.value, sizeof(T));
+  return true;
+}
+
+template <typename T>
+bool saveNvsBlob(Preferences& prefs, const char* key, uint16_t version, const T& value) {
+  NvsBlob<T> blob;
+  memset(&blob, 0, sizeof(blob));
+  blob.version = version;
+  blob.size = sizeof(T);
+  memcpy(&blob.value, &value, sizeof(T));
+  blob.crc = nvsCrc32(&blob.value, sizeof(T));
+  return prefs.putBytes(key, &blob, sizeof(blob)) == sizeof(blob);
+}
+
+#endif
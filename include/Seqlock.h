@@ -0,0 +1,50 @@
+/*
+ * Seqlock - single-writer snapshot that readers copy without locking
+ *
+ * The writer bumps the sequence to odd, copies the value in and bumps it
+ * back to even. A reader copies the value out and retries if the sequence
+ * was odd or moved while it was copying, so neither side ever waits on a
+ * mutex. Meant for small POD structs published a few times per second.
+ *
+ * On a single core the writer must not be preempted by a reader that then
+ * spins, so the writing task should run at a higher priority than readers.
+ */
+
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+
+template <typename T>
+class Seqlock {
+public:
+  void write(const T& value) {
+    uint32_t s = seq.load(std::memory_order_relaxed);
+    seq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy((void*)&data, &value, sizeof(T));
+    seq.store(s + 2, std::memory_order_release);
+  }
+
+  // Copy of the newest value; returns its version
+  uint32_t read(T& out) const {
+    for (;;) {
+      uint32_t s0 = seq.load(std::memory_order_acquire);
+      if (s0 & 1) continue;
+      memcpy(&out, (const void*)&data, sizeof(T));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq.load(std::memory_order_relaxed) == s0) return s0;
+    }
+  }
+
+  // Changes whenever a new value is published
+  uint32_t version() const { return seq.load(std::memory_order_acquire); }
+
+private:
+  std::atomic<uint32_t> seq{0};
+  T data;
+};
+
+#endif
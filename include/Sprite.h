@@ -0,0 +1,84 @@
+/*
+ * Sprite - compile-time 1bpp sprites blitted straight into the SSD1306 buffer
+ *
+ * Sprites are stored column-major in the panel's own layout: each column
+ * is PAGES bytes, one per 8-row page, bit 0 = top row. They are built at
+ * compile time from ASCII art ('#' = lit) and can be mirrored at compile
+ * time, so a left-facing frame costs no code and no draw-time branches.
+ *
+ * blitColumns() ORs a column bitmap into the framebuffer at any (x, y),
+ * clipped to the screen. A y that isn't on a page boundary splits every
+ * byte across two pages with a shift, so each lit byte is at most two ORs.
+ */
+
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include <stdint.h>
+#include <Adafruit_SSD1306.h>
+
+template <int W, int H>
+struct Sprite {
+  static constexpr int WIDTH = W;
+  static constexpr int HEIGHT = H;
+  static constexpr int PAGES = (H + 7) / 8;
+  uint8_t columns[W * PAGES];  // [column * PAGES + page]
+};
+
+// Sprite from H string rows of equal length, '#' for a lit pixel
+template <int H, int ROW>
+constexpr Sprite<ROW - 1, H> spriteFromRows(const char (&rows)[H][ROW]) {
+  Sprite<ROW - 1, H> sprite{};
+  for (int y = 0; y < H; y++) {
+    for (int x = 0; x < ROW - 1; x++) {
+      if (rows[y][x] == '#') {
+        sprite.columns[x * sprite.PAGES + y / 8] |= 1 << (y % 8);
+      }
+    }
+  }
+  return sprite;
+}
+
+// Left-right mirror image
+template <int W, int H>
+constexpr Sprite<W, H> mirrored(const Sprite<W, H>& in) {
+  Sprite<W, H> out{};
+  for (int x = 0; x < W; x++) {
+    for (int p = 0; p < in.PAGES; p++) {
+      out.columns[x * in.PAGES + p] = in.columns[(W - 1 - x) * in.PAGES + p];
+    }
+  }
+  return out;
+}
+
+// OR `width` columns of `pages` bytes each into the framebuffer with the
+// top-left corner at (x, y), clipped to the screen
+inline void blitColumns(Adafruit_SSD1306& display, const uint8_t* columns, int width, int pages,
+                        int x, int y) {
+  uint8_t* buf = display.getBuffer();
+  const int screen_w = display.width();
+  const int screen_pages = display.height() / 8;
+  const int shift = y & 7;
+  const int page0 = (y - shift) / 8;  // Floor, also for negative y
+
+  for (int col = 0; col < width; col++, columns += pages) {
+    int px = x + col;
+    if (px < 0 || px >= screen_w) continue;
+    for (int p = 0; p < pages; p++) {
+      uint8_t b = columns[p];
+      if (!b) continue;
+      int page = page0 + p;
+      if (page >= 0 && page < screen_pages) buf[page * screen_w + px] |= b << shift;
+      if (shift && page + 1 >= 0 && page + 1 < screen_pages) {
+        buf[(page + 1) * screen_w + px] |= b >> (8 - shift);
+      }
+    }
+  }
+}
+
+template <int W, int H>
+inline void blitSprite(Adafruit_SSD1306& display, const Sprite<W, H>& sprite, int x, int y) {
+  blitColumns(display, sprite.columns, W, sprite.PAGES, x, y);
+}
+
+#endif
@@ -0,0 +1,268 @@
+/*
+ * StatsProtocol - compact binary UDP stats packet
+ *
+ * Fixed layout, little-endian, 24 bytes (vs ~250 bytes of JSON):
+ *
+ *   off size  field
+ *    0   2    magic          0x4D50 ("PM" on the wire)
+ *    2   1    version        STATS_PROTOCOL_VERSION
+ *    3   1    flags          STATS_FLAG_* bits
+ *    4   2    seq            sender sequence number, wraps at 65535
+ *    6   2    present        STATS_FIELD_* bits for the fields below
+ *    8   2    cpu_percent    x10 (0.1 %)
+ *   10   2    ram_percent    x10
+ *   12   2    ram_used_gb    x10 (0.1 GB)
+ *   14   2    ram_total_gb   x10
+ *   16   2    disk_percent   x10
+ *   18   1    cpu_temp       int8, deg C
+ *   19   1    gpu_temp       int8, deg C
+ *   20   2    fan_speed      RPM
+ *   22   1    hour           sender wall clock
+ *   23   1    minute
+ *   24   1    host_id        only if flags has STATS_FLAG_HOST_ID
+ *   +0   4    send_ms        only if flags has STATS_FLAG_SEND_TIME, right
+ *                            after host_id (or at 24 without it)
+ *   +0   1    core_count     only if flags has STATS_FLAG_CORES, after
+ *   +1   n    cores          send_ms: per-core load, 0.5 % steps (0-200),
+ *                            at most STATS_MAX_CORES
+ *
+ * Senders that share one display set a host ID so each machine gets its own
+ * page even behind NAT; without it the display keys hosts by IP address.
+ * send_ms is the sender's monotonic clock in milliseconds (wrapping at
+ * 2^32), for measuring how long the numbers took to reach the screen; the
+ * two clocks aren't synchronised, so only its changes mean anything.
+ * A field whose present bit is clear is treated like a JSON null. JSON
+ * datagrams always start with '{', so the magic never collides with them.
+ * Per-core load is optional; in JSON it is "cpu_cores": [percent, ...].
+ *
+ * Delta packets (STATS_FLAG_DELTA) carry only the fields whose present bit
+ * is set, packed in the order above right after `present` (the timestamp as
+ * hour, minute), then host_id and send_ms as usual; a clear bit there means
+ * "unchanged", not null, and so does a delta without STATS_FLAG_CORES for
+ * the per-core loads. A packet without the flag is a keyframe: every
+ * field is on the wire and replaces what the display has. Senders send a
+ * keyframe every few seconds, whenever a field appears or disappears, and
+ * when the display asks for one with a keyframe request, which it sends
+ * back to the sender's address and port after a sequence gap:
+ *
+ *    0   2    magic          0x4B50 ("PK" on the wire)
+ *    2   1    version        STATS_PROTOCOL_VERSION
+ *    3   1    reserved       0
+ */
+
+#ifndef STATS_PROTOCOL_H
+#define STATS_PROTOCOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define STATS_PROTOCOL_MAGIC 0x4D50
+#define STATS_PROTOCOL_VERSION 1
+#define STATS_PACKET_SIZE 24
+#define STATS_MAX_CORES 64
+#define STATS_PACKET_MAX_SIZE (29 + 1 + STATS_MAX_CORES)
+#define STATS_DELTA_HEADER_SIZE 8
+
+#define STATS_FLAG_HOST_ID 0x01
+#define STATS_FLAG_SEND_TIME 0x02
+#define STATS_FLAG_DELTA 0x04
+#define STATS_FLAG_CORES 0x08
+
+#define STATS_KEYFRAME_REQUEST_MAGIC 0x4B50
+#define STATS_KEYFRAME_REQUEST_SIZE 4
+
+enum StatsField : uint16_t {
+  STATS_FIELD_CPU_PERCENT  = 1 << 0,
+  STATS_FIELD_RAM_PERCENT  = 1 << 1,
+  STATS_FIELD_RAM_USED     = 1 << 2,
+  STATS_FIELD_RAM_TOTAL    = 1 << 3,
+  STATS_FIELD_DISK_PERCENT = 1 << 4,
+  STATS_FIELD_CPU_TEMP     = 1 << 5,
+  STATS_FIELD_GPU_TEMP     = 1 << 6,
+  STATS_FIELD_FAN_SPEED    = 1 << 7,
+  STATS_FIELD_TIMESTAMP    = 1 << 8,
+  STATS_FIELD_ALL          = (1 << 9) - 1
+};
+
+// Raw on-the-wire values, fixed-point as sent
+struct StatsWire {
+  uint8_t version;
+  uint8_t flags;
+  uint16_t seq;
+  uint16_t present;
+  uint16_t cpu_percent_x10;
+  uint16_t ram_percent_x10;
+  uint16_t ram_used_x10;
+  uint16_t ram_total_x10;
+  uint16_t disk_percent_x10;
+  int8_t cpu_temp;
+  int8_t gpu_temp;
+  uint16_t fan_speed;
+  uint8_t hour;
+  uint8_t minute;
+  uint8_t host_id;  // 0 = none
+  uint32_t send_ms; // Only meaningful with STATS_FLAG_SEND_TIME
+  uint8_t core_count;  // Only meaningful with STATS_FLAG_CORES
+  uint8_t cores[STATS_MAX_CORES];
+};
+
+inline uint16_t statsGet16(const uint8_t* p) {
+  return (uint16_t)p[0] | ((uint16_t)p[1] << 8);
+}
+
+inline void statsPut16(uint8_t* p, uint16_t v) {
+  p[0] = v & 0xFF;
+  p[1] = v >> 8;
+}
+
+inline uint32_t statsGet32(const uint8_t* p) {
+  return (uint32_t)statsGet16(p) | ((uint32_t)statsGet16(p + 2) << 16);
+}
+
+inline void statsPut32(uint8_t* p, uint32_t v) {
+  statsPut16(p, v & 0xFFFF);
+  statsPut16(p + 2, v >> 16);
+}
+
+// Bytes on the wire for one STATS_FIELD_* bit (the two temperatures are 1)
+inline size_t statsFieldSize(uint16_t field) {
+  return (field == STATS_FIELD_CPU_TEMP || field == STATS_FIELD_GPU_TEMP) ? 1 : 2;
+}
+
+// Length of the header and fields, before host_id and send_ms; `present`
+// only matters for a delta
+inline size_t statsFieldsSize(uint8_t flags, uint16_t present) {
+  if (!(flags & STATS_FLAG_DELTA)) return STATS_PACKET_SIZE;
+  size_t size = STATS_DELTA_HEADER_SIZE;
+  for (uint16_t field = 1; field & STATS_FIELD_ALL; field <<= 1) {
+    if (present & field) size += statsFieldSize(field);
+  }
+  return size;
+}
+
+// Packet length for these flags (and, for a delta, these fields)
+inline size_t statsWireSize(uint8_t flags, uint16_t present = STATS_FIELD_ALL,
+                            uint8_t core_count = 0) {
+  size_t size = statsFieldsSize(flags, present);
+  if (flags & STATS_FLAG_HOST_ID) size += 1;
+  if (flags & STATS_FLAG_SEND_TIME) size += 4;
+  if (flags & STATS_FLAG_CORES) size += 1 + core_count;
+  return size;
+}
+
+// True if the datagram carries the binary magic (any version)
+inline bool statsIsBinary(const uint8_t* buf, size_t len) {
+  return len >= 2 && statsGet16(buf) == STATS_PROTOCOL_MAGIC;
+}
+
+// True for a binary delta, which only updates the fields it carries
+inline bool statsIsDelta(const uint8_t* buf, size_t len) {
+  return len >= 4 && statsIsBinary(buf, len) && (buf[3] & STATS_FLAG_DELTA);
+}
+
+inline bool statsIsKeyframeRequest(const uint8_t* buf, size_t len) {
+  return len >= STATS_KEYFRAME_REQUEST_SIZE && statsGet16(buf) == STATS_KEYFRAME_REQUEST_MAGIC &&
+         buf[2] == STATS_PROTOCOL_VERSION;
+}
+
+inline size_t statsEncodeKeyframeRequest(uint8_t* buf, size_t cap) {
+  if (cap < STATS_KEYFRAME_REQUEST_SIZE) return 0;
+  statsPut16(buf, STATS_KEYFRAME_REQUEST_MAGIC);
+  buf[2] = STATS_PROTOCOL_VERSION;
+  buf[3] = 0;
+  return STATS_KEYFRAME_REQUEST_SIZE;
+}
+
+// Sequence number of a binary packet, without decoding the rest
+inline bool statsPeekSeq(const uint8_t* buf, size_t len, uint16_t& seq) {
+  if (len < 6 || !statsIsBinary(buf, len)) return false;
+  seq = statsGet16(buf + 4);
+  return true;
+}
+
+// Decode a binary packet. Returns false on a short packet (including one cut
+// off inside a flagged host id, send time or core block), bad magic or
+// unknown version; `out` is then left untouched. Fields a delta doesn't
+// carry read as 0.
+inline bool statsWireDecode(const uint8_t* buf, size_t len, StatsWire& out) {
+  if (len < STATS_DELTA_HEADER_SIZE || statsGet16(buf) != STATS_PROTOCOL_MAGIC ||
+      buf[2] != STATS_PROTOCOL_VERSION) {
+    return false;
+  }
+  uint8_t flags = buf[3];
+  uint16_t present = statsGet16(buf + 6);
+  size_t at = statsFieldsSize(flags, present);
+  if (len < statsWireSize(flags, present)) return false;
+
+  StatsWire w = {};
+  w.version = buf[2];
+  w.flags = flags;
+  w.seq = statsGet16(buf + 4);
+  w.present = present;
+  uint16_t wire = (flags & STATS_FLAG_DELTA) ? present : (uint16_t)STATS_FIELD_ALL;
+  const uint8_t* p = buf + STATS_DELTA_HEADER_SIZE;
+  if (wire & STATS_FIELD_CPU_PERCENT) { w.cpu_percent_x10 = statsGet16(p); p += 2; }
+  if (wire & STATS_FIELD_RAM_PERCENT) { w.ram_percent_x10 = statsGet16(p); p += 2; }
+  if (wire & STATS_FIELD_RAM_USED) { w.ram_used_x10 = statsGet16(p); p += 2; }
+  if (wire & STATS_FIELD_RAM_TOTAL) { w.ram_total_x10 = statsGet16(p); p += 2; }
+  if (wire & STATS_FIELD_DISK_PERCENT) { w.disk_percent_x10 = statsGet16(p); p += 2; }
+  if (wire & STATS_FIELD_CPU_TEMP) w.cpu_temp = (int8_t)*p++;
+  if (wire & STATS_FIELD_GPU_TEMP) w.gpu_temp = (int8_t)*p++;
+  if (wire & STATS_FIELD_FAN_SPEED) { w.fan_speed = statsGet16(p); p += 2; }
+  if (wire & STATS_FIELD_TIMESTAMP) { w.hour = p[0]; w.minute = p[1]; }
+
+  if (flags & STATS_FLAG_HOST_ID) w.host_id = buf[at++];
+  if (flags & STATS_FLAG_SEND_TIME) {
+    w.send_ms = statsGet32(buf + at);
+    at += 4;
+  }
+  if (flags & STATS_FLAG_CORES) {
+    size_t count = buf[at];
+    if (len < at + 1 + count) return false;
+    if (count == 0 || count > STATS_MAX_CORES) {
+      w.flags &= ~STATS_FLAG_CORES;  // More than we keep: no per-core data
+    } else {
+      w.core_count = count;
+      memcpy(w.cores, buf + at + 1, count);
+    }
+  }
+  out = w;
+  return true;
+}
+
+// Encode into `buf`; returns the packet length, or 0 if `cap` is too small.
+// With STATS_FLAG_DELTA only the fields in `present` are written.
+inline size_t statsWireEncode(const StatsWire& in, uint8_t* buf, size_t cap) {
+  if ((in.flags & STATS_FLAG_CORES) && in.core_count > STATS_MAX_CORES) return 0;
+  size_t size = statsWireSize(in.flags, in.present, in.core_count);
+  if (cap < size) return 0;
+  statsPut16(buf, STATS_PROTOCOL_MAGIC);
+  buf[2] = STATS_PROTOCOL_VERSION;
+  buf[3] = in.flags;
+  statsPut16(buf + 4, in.seq);
+  statsPut16(buf + 6, in.present);
+  uint16_t wire = (in.flags & STATS_FLAG_DELTA) ? in.present : (uint16_t)STATS_FIELD_ALL;
+  uint8_t* p = buf + STATS_DELTA_HEADER_SIZE;
+  if (wire & STATS_FIELD_CPU_PERCENT) { statsPut16(p, in.cpu_percent_x10); p += 2; }
+  if (wire & STATS_FIELD_RAM_PERCENT) { statsPut16(p, in.ram_percent_x10); p += 2; }
+  if (wire & STATS_FIELD_RAM_USED) { statsPut16(p, in.ram_used_x10); p += 2; }
+  if (wire & STATS_FIELD_RAM_TOTAL) { statsPut16(p, in.ram_total_x10); p += 2; }
+  if (wire & STATS_FIELD_DISK_PERCENT) { statsPut16(p, in.disk_percent_x10); p += 2; }
+  if (wire & STATS_FIELD_CPU_TEMP) *p++ = (uint8_t)in.cpu_temp;
+  if (wire & STATS_FIELD_GPU_TEMP) *p++ = (uint8_t)in.gpu_temp;
+  if (wire & STATS_FIELD_FAN_SPEED) { statsPut16(p, in.fan_speed); p += 2; }
+  if (wire & STATS_FIELD_TIMESTAMP) { *p++ = in.hour; *p++ = in.minute; }
+  if (in.flags & STATS_FLAG_HOST_ID) *p++ = in.host_id;
+  if (in.flags & STATS_FLAG_SEND_TIME) {
+    statsPut32(p, in.send_ms);
+    p += 4;
+  }
+  if (in.flags & STATS_FLAG_CORES) {
+    *p++ = in.core_count;
+    memcpy(p, in.cores, in.core_count);
+  }
+  return size;
+}
+
+#endif
@@ -0,0 +1,583 @@
+/*
+ * WebAssets - web UI, gzipped and plain, generated by tools/embed_web.py from web/
+ *
+ * Do not edit; change the files in web/ and re-run the script.
+ */
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset {
+  const char* path;
+  const char* type;
+  const uint8_t* data;  // gzip
+  size_t len;
+  const char* etag;
+  const uint8_t* raw;   // Uncompressed, for clients without gzip
+  size_t raw_len;
+  const char* raw_etag;
+};
+
+// index.html: 6477 bytes, 2302 gzipped
+const uint8_t WEB_INDEX_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x59, 0x59, 0x73, 0xdb, 0x38,
+  0x12, 0x7e, 0xcf, 0xaf, 0xe8, 0xe1, 0xcc, 0x2e, 0xa9, 0x8a, 0x44, 0x1d, 0x96, 0x13, 0x8f, 0x2c,
+  0x6b, 0xd6, 0x91, 0xe4, 0xa3, 0xc6, 0x1a, 0xab, 0x2c, 0x67, 0xb7, 0x52, 0x53, 0xf3, 0x00, 0x91,
+  0xa0, 0x84, 0x35, 0xaf, 0x05, 0x40, 0x3b, 0x4a, 0x36, 0x8f, 0xfb, 0x2f, 0xf6, 0xd7, 0xed, 0x2f,
+  0xd9, 0x06, 0xc0, 0x4b, 0xb6, 0x2c, 0x3b, 0x0f, 0xe3, 0x17, 0x11, 0x44, 0x1f, 0x5f, 0x1f, 0xe8,
+  0x6e, 0xd0, 0xc3, 0x1f, 0x26, 0xd7, 0xe3, 0xdb, 0x4f, 0xf3, 0x29, 0xac, 0x65, 0x14, 0x8e, 0xde,
+  0x0c, 0x8b, 0x1f, 0x4a, 0xfc, 0xd1, 0x1b, 0x80, 0x61, 0x44, 0x25, 0x01, 0x6f, 0x4d, 0xb8, 0xa0,
+  0xf2, 0xc4, 0xca, 0x64, 0xd0, 0x3a, 0xb2, 0xaa, 0x8d, 0x98, 0x44, 0xf4, 0xc4, 0xba, 0x67, 0xf4,
+  0x21, 0x4d, 0xb8, 0xb4, 0xc0, 0x4b, 0x62, 0x49, 0x63, 0x24, 0x7c, 0x60, 0xbe, 0x5c, 0x9f, 0xf8,
+  0xf4, 0x9e, 0x79, 0xb4, 0xa5, 0x17, 0x4d, 0x60, 0x31, 0x93, 0x8c, 0x84, 0x2d, 0xe1, 0x91, 0x90,
+  0x9e, 0x74, 0x8d, 0x18, 0xc9, 0x64, 0x48, 0x47, 0xf3, 0x31, 0xcc, 0x12, 0xdc, 0x4e, 0x38, 0x2c,
+  0xa8, 0x94, 0x2c, 0x5e, 0x89, 0x61, 0xdb, 0x6c, 0x29, 0x22, 0x21, 0x37, 0xe6, 0x09, 0x60, 0x99,
+  0xf8, 0x1b, 0xf8, 0x0a, 0x01, 0x2a, 0x6a, 0x05, 0x24, 0x62, 0xe1, 0x66, 0x00, 0xa7, 0x1c, 0xc5,
+  0x36, 0x41, 0x90, 0x58, 0xb4, 0x04, 0xe5, 0x2c, 0x38, 0x86, 0x88, 0xf0, 0x15, 0x8b, 0x07, 0xd0,
+  0xeb, 0xa4, 0x9f, 0x8f, 0x61, 0x49, 0xbc, 0xbb, 0x15, 0x4f, 0xb2, 0xd8, 0x1f, 0xc0, 0x8f, 0x5d,
+  0xd2, 0x25, 0x3d, 0x7a, 0x8c, 0x58, 0xc3, 0x84, 0xe3, 0x9a, 0x52, 0x5c, 0x7c, 0xd3, 0xc2, 0x5d,
+  0x85, 0x9f, 0xb0, 0x98, 0x72, 0x54, 0x11, 0x91, 0xcf, 0x06, 0xf9, 0x00, 0xfa, 0x1d, 0x2d, 0xa6,
+  0x10, 0xda, 0x01, 0x92, 0xc9, 0xa4, 0x60, 0x5a, 0x77, 0x91, 0xb8, 0x10, 0xd6, 0xe9, 0xf8, 0xfd,
+  0x00, 0xf5, 0x4b, 0xfa, 0x59, 0xb6, 0x48, 0xc8, 0x56, 0x48, 0xee, 0xa1, 0x47, 0x28, 0xaf, 0x74,
+  0x10, 0xee, 0x23, 0xc7, 0x36, 0xa6, 0x77, 0xbd, 0xee, 0x01, 0xc2, 0x48, 0x89, 0xef, 0xa3, 0xf1,
+  0x25, 0xee, 0x84, 0xfb, 0x94, 0xb7, 0x38, 0xf1, 0x59, 0x26, 0x06, 0xd0, 0xad, 0xa1, 0x68, 0x2d,
+  0x13, 0x29, 0x93, 0xa8, 0xa0, 0x34, 0xb2, 0x43, 0xb2, 0xa4, 0x21, 0xca, 0xf6, 0x99, 0x48, 0x43,
+  0x82, 0x9e, 0x59, 0x86, 0x89, 0x77, 0x57, 0x01, 0xef, 0x1e, 0xa6, 0x9f, 0x11, 0xfd, 0xa1, 0xe2,
+  0x78, 0x8c, 0xd8, 0x48, 0x10, 0x34, 0xa4, 0x9e, 0x54, 0xb1, 0x4a, 0x33, 0x89, 0x92, 0x72, 0x07,
+  0x74, 0x3b, 0x9d, 0xbf, 0xd4, 0xd0, 0x75, 0x6b, 0xe8, 0x06, 0x10, 0x27, 0x31, 0x7d, 0x82, 0xf5,
+  0xf0, 0x89, 0xdf, 0x3b, 0xc1, 0x41, 0xff, 0x5d, 0xa7, 0x52, 0x1c, 0x28, 0xad, 0x3a, 0x8e, 0x82,
+  0x7d, 0xa1, 0x28, 0xf4, 0x5d, 0x65, 0x88, 0x81, 0x31, 0x08, 0x12, 0x2f, 0x13, 0x39, 0x18, 0xb3,
+  0x40, 0x48, 0x49, 0x26, 0x43, 0x0c, 0x11, 0x5a, 0x8e, 0xc6, 0x88, 0x24, 0x64, 0xfe, 0x63, 0x23,
+  0x96, 0x19, 0xba, 0x26, 0x7e, 0x1e, 0xfd, 0x61, 0xcd, 0x8d, 0x32, 0x49, 0xb7, 0xbd, 0xbd, 0xcf,
+  0x9e, 0x3a, 0xda, 0x23, 0xed, 0xc4, 0x8c, 0x0b, 0x65, 0x4c, 0x9a, 0xb0, 0xad, 0x18, 0x0b, 0x72,
+  0x4f, 0x5b, 0x4b, 0x19, 0x3f, 0x8e, 0x73, 0x81, 0xb3, 0xf0, 0x41, 0x91, 0x8b, 0x8f, 0xd8, 0x06,
+  0xeb, 0xe4, 0x5e, 0xe7, 0xe0, 0x23, 0x66, 0x72, 0xe4, 0x79, 0x25, 0x31, 0xa7, 0x78, 0x24, 0x77,
+  0x29, 0xa1, 0x3f, 0xf7, 0x0f, 0x9f, 0x38, 0xfa, 0x31, 0xd3, 0x6e, 0x15, 0xde, 0xfb, 0x03, 0x7a,
+  0xd8, 0x2f, 0xa9, 0x59, 0x1c, 0x24, 0x48, 0xb2, 0x2b, 0x99, 0x0b, 0xe1, 0x47, 0x47, 0x47, 0xdb,
+  0x7e, 0xe9, 0xed, 0x76, 0x6e, 0x61, 0xa1, 0x24, 0x52, 0x47, 0x71, 0x67, 0x6a, 0xec, 0x4c, 0xb0,
+  0xed, 0x10, 0xec, 0xc2, 0xb2, 0xe7, 0x44, 0xb8, 0x91, 0x58, 0xbd, 0x60, 0x41, 0x11, 0x93, 0x08,
+  0x45, 0xac, 0x29, 0x5b, 0xad, 0x25, 0xea, 0x77, 0x7b, 0x34, 0xaa, 0xcb, 0x70, 0x29, 0xe7, 0x09,
+  0xaf, 0x1d, 0xf4, 0xc2, 0xc9, 0x8a, 0x64, 0xd8, 0xce, 0x0b, 0xd4, 0xb0, 0x6d, 0xea, 0xe6, 0x50,
+  0x55, 0x29, 0x5d, 0xb9, 0x7c, 0x76, 0x0f, 0x5e, 0x48, 0x84, 0x38, 0xb1, 0xca, 0xda, 0x62, 0x99,
+  0x4a, 0x36, 0x5c, 0x77, 0x47, 0x7f, 0xfd, 0xb1, 0xdb, 0x3b, 0xea, 0xf7, 0xba, 0xc7, 0x50, 0x55,
+  0x40, 0x14, 0xd2, 0xcd, 0x29, 0x6a, 0xdc, 0xc6, 0x71, 0x39, 0xab, 0x2e, 0x89, 0x3c, 0x89, 0x57,
+  0xa3, 0xcb, 0xf9, 0x40, 0x69, 0xd7, 0xcf, 0xf8, 0x32, 0x25, 0x31, 0x30, 0xff, 0xc4, 0x62, 0xa9,
+  0x35, 0x6a, 0xe1, 0x06, 0xae, 0x47, 0xf0, 0xef, 0x92, 0xfa, 0xe3, 0x64, 0x0e, 0x73, 0x2c, 0xd4,
+  0x3b, 0x79, 0x32, 0x3f, 0x55, 0x7b, 0x15, 0xe3, 0x70, 0xc9, 0x1f, 0xab, 0x9b, 0x98, 0xc2, 0x02,
+  0x97, 0xbd, 0xf1, 0x6e, 0xbd, 0x3d, 0xaf, 0xe2, 0x37, 0x36, 0xb4, 0xd1, 0x88, 0xfc, 0x31, 0x48,
+  0x78, 0xa4, 0xc9, 0x44, 0x5e, 0xe3, 0x2b, 0x73, 0xea, 0x7e, 0xc2, 0xfa, 0x58, 0x6e, 0x28, 0x37,
+  0x1d, 0x18, 0x37, 0x1d, 0xf4, 0x31, 0xd3, 0xc6, 0xaa, 0xa0, 0xd5, 0x7a, 0x04, 0x6e, 0xbe, 0xa9,
+  0x48, 0x4d, 0xfd, 0x43, 0x35, 0x28, 0x45, 0x11, 0x2e, 0x54, 0x58, 0xac, 0xd1, 0xa5, 0x1f, 0xd2,
+  0x82, 0x53, 0xbd, 0x19, 0xb6, 0x35, 0x61, 0x4d, 0x87, 0xa9, 0x37, 0x79, 0x3b, 0xab, 0xb1, 0x6a,
+  0xb4, 0x75, 0x51, 0x25, 0x0b, 0x32, 0x25, 0xa9, 0x64, 0x58, 0x66, 0xee, 0x49, 0x98, 0x21, 0x57,
+  0xc7, 0x1a, 0xcd, 0x08, 0x67, 0x09, 0x9c, 0xc6, 0x2c, 0x22, 0x6a, 0x67, 0xd8, 0x36, 0x14, 0x7b,
+  0x98, 0xb0, 0x09, 0x2e, 0x24, 0x89, 0x7d, 0xd5, 0x12, 0x34, 0xc0, 0x57, 0xf0, 0xf4, 0xac, 0xd1,
+  0x15, 0x26, 0x3c, 0x7d, 0x8e, 0x01, 0xbd, 0xaf, 0xad, 0x79, 0xc6, 0x31, 0x99, 0xa0, 0xbd, 0xfe,
+  0x45, 0x92, 0x61, 0x1a, 0xde, 0xb2, 0x88, 0xc2, 0x19, 0x06, 0x85, 0xc8, 0x17, 0x5c, 0x52, 0x31,
+  0x99, 0x54, 0xa9, 0x64, 0xec, 0xb5, 0xad, 0xd7, 0x6f, 0x29, 0x2a, 0x70, 0xba, 0xfd, 0xc1, 0x41,
+  0xa7, 0xf1, 0x0a, 0xe3, 0xd0, 0x8b, 0xdd, 0x5e, 0xce, 0xd4, 0x43, 0x1e, 0x98, 0xcf, 0x1a, 0xdf,
+  0x6d, 0xa2, 0x4f, 0x24, 0x35, 0x66, 0x59, 0xa3, 0x09, 0x3e, 0xbf, 0xce, 0xc6, 0x1a, 0x97, 0x36,
+  0xb2, 0x2e, 0x65, 0x2f, 0xe0, 0xc9, 0xa4, 0x3d, 0x9b, 0xb5, 0x3f, 0xe1, 0xdf, 0xeb, 0x22, 0x8e,
+  0xc4, 0xc8, 0xf2, 0x4a, 0x7a, 0x8c, 0xb6, 0xa2, 0x6c, 0xcd, 0x66, 0xad, 0xc9, 0x64, 0x9f, 0x27,
+  0x8a, 0xb5, 0x3e, 0x6e, 0xaf, 0x3f, 0x56, 0xef, 0xdf, 0xab, 0x2a, 0xa6, 0x32, 0xe1, 0x0b, 0xb6,
+  0xbd, 0x3d, 0x07, 0x6a, 0x15, 0xc9, 0xeb, 0x20, 0xc0, 0x93, 0x6b, 0x8d, 0xce, 0x67, 0xb7, 0x60,
+  0x9e, 0xc1, 0x59, 0x63, 0xa8, 0x44, 0xe3, 0x05, 0xd7, 0x56, 0xbc, 0xda, 0xb3, 0x35, 0x51, 0x2f,
+  0x45, 0x52, 0xe8, 0x10, 0x6e, 0x42, 0x55, 0x96, 0x61, 0x41, 0xee, 0xf1, 0xd4, 0x6b, 0xb0, 0x2f,
+  0xc5, 0x52, 0x14, 0x41, 0x14, 0xf2, 0x85, 0x1c, 0x9d, 0xc6, 0x64, 0x19, 0x52, 0x1f, 0x9c, 0xb7,
+  0x5d, 0x50, 0xc6, 0xbc, 0x32, 0x4b, 0xb1, 0x12, 0x6a, 0xbe, 0x3f, 0x21, 0x24, 0x47, 0xbd, 0x0e,
+  0x86, 0x04, 0xeb, 0x82, 0x14, 0xb0, 0xf0, 0x38, 0xa5, 0xf1, 0x9e, 0xb0, 0xa8, 0xbe, 0x20, 0xf2,
+  0xe2, 0x94, 0xb3, 0xbc, 0xa2, 0xc4, 0xd5, 0xb8, 0x4c, 0x41, 0xae, 0x49, 0xd9, 0x6b, 0xf6, 0x38,
+  0xe3, 0x1c, 0xfb, 0x27, 0xfc, 0x5d, 0xbd, 0x11, 0xe0, 0x7c, 0x20, 0x3a, 0xfa, 0xaf, 0x49, 0xfb,
+  0x0b, 0x26, 0xb0, 0xbb, 0x6d, 0xe0, 0x9c, 0x93, 0x74, 0x2d, 0x5e, 0x97, 0xfa, 0x73, 0x6c, 0xff,
+  0xe3, 0x84, 0x53, 0x50, 0x7a, 0xfe, 0x0c, 0x57, 0x77, 0x7f, 0x3e, 0x3c, 0x86, 0xa2, 0xab, 0x5d,
+  0x29, 0x97, 0xe5, 0x4d, 0xa5, 0xa4, 0x4c, 0x41, 0x37, 0x77, 0xd5, 0xbf, 0x9f, 0x99, 0x78, 0xfa,
+  0x8f, 0x27, 0x9e, 0xce, 0xb1, 0x72, 0x14, 0x5a, 0x1b, 0x21, 0x81, 0x19, 0xca, 0x05, 0x88, 0x75,
+  0xf2, 0x10, 0x03, 0x5a, 0x77, 0x7d, 0x35, 0x9d, 0xc0, 0xc3, 0x9a, 0xc6, 0xaa, 0xe7, 0x6b, 0xc7,
+  0x03, 0x41, 0x0b, 0xf3, 0x99, 0x5d, 0x65, 0x54, 0xfa, 0x4c, 0xac, 0x03, 0x12, 0x6b, 0x88, 0xd6,
+  0xe8, 0x8c, 0xc4, 0xed, 0x79, 0x16, 0xa5, 0x06, 0xf2, 0xd3, 0x60, 0x9b, 0xf1, 0x5d, 0x6e, 0x52,
+  0xc4, 0xad, 0x66, 0x1f, 0x2b, 0x8f, 0x7b, 0x29, 0x41, 0x47, 0xbd, 0x5a, 0xe1, 0x5d, 0x27, 0xa4,
+  0xf1, 0x0a, 0xaf, 0x6c, 0x56, 0xf7, 0xd0, 0x02, 0x04, 0xe2, 0xd1, 0x75, 0x12, 0xe2, 0xf4, 0x75,
+  0x62, 0xcd, 0x3f, 0xce, 0xe6, 0x4d, 0x38, 0x3b, 0xfd, 0xad, 0x09, 0xe3, 0x6b, 0x04, 0x7f, 0x63,
+  0x3d, 0xd7, 0x72, 0xd3, 0x2c, 0x87, 0x37, 0x9e, 0x7f, 0xfc, 0x5e, 0x64, 0x25, 0xb3, 0x69, 0xb9,
+  0xe5, 0x6a, 0x1f, 0x32, 0x54, 0xd3, 0x84, 0xf9, 0xcd, 0xf5, 0x78, 0xba, 0x58, 0x5c, 0x3f, 0x0b,
+  0x8b, 0x93, 0x28, 0x87, 0x75, 0x73, 0x3a, 0xfb, 0x5e, 0x58, 0x25, 0xb3, 0x86, 0x55, 0xad, 0xf6,
+  0xc1, 0x42, 0x35, 0x4d, 0x98, 0x4d, 0x67, 0xd7, 0x37, 0x9f, 0x9e, 0xc3, 0xb4, 0x2a, 0x5d, 0x75,
+  0xfe, 0xfd, 0xae, 0x5a, 0x6d, 0xb9, 0x6a, 0xf5, 0x2a, 0x57, 0x9d, 0x2b, 0x57, 0x9d, 0xdf, 0x9c,
+  0xce, 0x2f, 0x2e, 0xc7, 0x8b, 0xe7, 0x50, 0x61, 0x0a, 0xde, 0xe5, 0xb0, 0xf0, 0x48, 0xdc, 0x7d,
+  0x2f, 0xae, 0x8a, 0xdd, 0x94, 0xde, 0x6a, 0xb9, 0x0f, 0xd9, 0xe4, 0x72, 0xf1, 0x6b, 0x13, 0x16,
+  0xb7, 0xd7, 0x37, 0xa7, 0xe7, 0x53, 0x7c, 0x58, 0x4c, 0xac, 0x67, 0x8e, 0x73, 0x7e, 0xad, 0x33,
+  0x8a, 0x45, 0xb6, 0x8c, 0x98, 0xfa, 0xe2, 0x90, 0x8f, 0xc7, 0xf9, 0xcd, 0xc9, 0x2a, 0x8e, 0xb5,
+  0xaa, 0xa0, 0xf8, 0xae, 0x36, 0x2a, 0x1a, 0xf6, 0x52, 0x76, 0x5a, 0xb0, 0xe2, 0x74, 0x6f, 0x00,
+  0xab, 0x87, 0x91, 0x3e, 0x7d, 0x46, 0xb9, 0x1a, 0x57, 0x73, 0xed, 0xdb, 0xba, 0xcd, 0xa2, 0xd4,
+  0x5d, 0xde, 0xa9, 0xf2, 0x24, 0xa1, 0xba, 0xb3, 0x99, 0x4a, 0xae, 0x9a, 0xeb, 0x8d, 0x7a, 0x01,
+  0xff, 0x60, 0x67, 0x6c, 0x07, 0x9a, 0x27, 0x83, 0xbe, 0xba, 0x73, 0x95, 0x1e, 0xc0, 0x0a, 0x61,
+  0x8a, 0x7a, 0xf1, 0x75, 0xe4, 0xbe, 0xe7, 0x76, 0x6a, 0x73, 0xf9, 0x38, 0x89, 0x03, 0xb6, 0xca,
+  0xb0, 0x7c, 0xcc, 0x37, 0x72, 0x8d, 0x00, 0x85, 0xc7, 0x59, 0x2a, 0xf1, 0xe2, 0x2b, 0xd7, 0x70,
+  0x39, 0xcf, 0x8b, 0x0e, 0x59, 0xe2, 0x5d, 0x6f, 0x7b, 0x1a, 0xaf, 0x1e, 0x0c, 0x87, 0x11, 0xd8,
+  0x6e, 0x6b, 0x75, 0xcc, 0xc3, 0x9b, 0xd8, 0x8a, 0xea, 0xeb, 0xad, 0xae, 0xf6, 0xf7, 0xa6, 0xda,
+  0x7b, 0x09, 0xce, 0x8b, 0x01, 0x4f, 0x22, 0x68, 0x93, 0x94, 0xb5, 0x8b, 0x29, 0x5e, 0xb3, 0xe2,
+  0xed, 0x46, 0x48, 0x38, 0xbb, 0x9c, 0x5e, 0x4d, 0x16, 0x70, 0x02, 0xbf, 0xdb, 0xd5, 0xd4, 0x6c,
+  0x37, 0xc1, 0x2e, 0x27, 0x46, 0xb5, 0xa8, 0x26, 0x2b, 0xb5, 0x2a, 0xa7, 0x01, 0xbd, 0x25, 0xf4,
+  0x4f, 0xd5, 0x8f, 0xec, 0x66, 0xad, 0x41, 0x54, 0x7f, 0x76, 0x51, 0xbb, 0x14, 0x75, 0x51, 0x2d,
+  0xd4, 0x73, 0x71, 0x44, 0xb5, 0xe4, 0xda, 0xfb, 0x32, 0x1b, 0xed, 0x3f, 0x8e, 0x6b, 0x80, 0x7f,
+  0x42, 0xac, 0xcc, 0x87, 0x93, 0x11, 0xf8, 0x89, 0x97, 0x45, 0x68, 0xac, 0xbb, 0xa2, 0x72, 0x1a,
+  0x52, 0xf5, 0xf8, 0x61, 0x73, 0xe9, 0x3b, 0xcc, 0x6f, 0x1c, 0x9b, 0x28, 0x61, 0x3e, 0x80, 0x13,
+  0x62, 0x28, 0x19, 0x32, 0xb5, 0xba, 0xbd, 0x63, 0x7c, 0x18, 0x9e, 0x60, 0xfd, 0xc7, 0x87, 0xb7,
+  0x6f, 0x1b, 0xf0, 0x35, 0x47, 0xfa, 0x93, 0x53, 0xb3, 0xa9, 0xe1, 0xe2, 0x9d, 0xd6, 0x89, 0xe9,
+  0x03, 0x5c, 0xeb, 0xe6, 0xe5, 0xd8, 0x38, 0x3d, 0xd9, 0xf0, 0x16, 0x1c, 0x06, 0xa3, 0x13, 0xe8,
+  0xc0, 0x2f, 0x60, 0xbf, 0xb5, 0x61, 0x00, 0xb6, 0xdd, 0xc0, 0xb7, 0xac, 0x09, 0xac, 0xd1, 0x30,
+  0x08, 0xbf, 0xe5, 0x6a, 0xb3, 0xd8, 0xd3, 0x6d, 0x31, 0xa2, 0x42, 0x60, 0x58, 0x1c, 0x75, 0xe6,
+  0x9a, 0xa0, 0x2f, 0xa4, 0x5b, 0x4a, 0x31, 0x7f, 0x51, 0x9d, 0xda, 0x1d, 0x9b, 0xcf, 0x70, 0x08,
+  0x53, 0xad, 0x8e, 0x1f, 0x93, 0xe8, 0x4c, 0xfb, 0x0d, 0xcf, 0x2c, 0x12, 0x98, 0x7b, 0x2d, 0x82,
+  0x50, 0x17, 0x65, 0xbd, 0xd0, 0x60, 0x14, 0xe1, 0x6e, 0x14, 0x2a, 0xa5, 0x1c, 0x51, 0x29, 0xd6,
+  0x5e, 0x31, 0xce, 0x0c, 0x20, 0x09, 0xf2, 0x14, 0x68, 0xa0, 0xb6, 0xa0, 0xe1, 0xea, 0xc4, 0x41,
+  0x2d, 0x0b, 0xc9, 0x31, 0x53, 0x1c, 0xf1, 0x7b, 0xf0, 0x47, 0xa3, 0x06, 0x87, 0xa5, 0x4f, 0x00,
+  0x0b, 0x97, 0xa5, 0x35, 0x8a, 0xfc, 0x52, 0xba, 0x83, 0x2c, 0xdf, 0xa9, 0x4b, 0xeb, 0x79, 0xbb,
+  0xc4, 0xf5, 0xbc, 0x0f, 0x1b, 0x49, 0x05, 0x8e, 0x12, 0x0b, 0xea, 0xa1, 0x8b, 0x6d, 0x58, 0xaa,
+  0x75, 0x5b, 0x60, 0x56, 0xe0, 0x52, 0xb8, 0x79, 0xe7, 0x3d, 0x4b, 0x85, 0xde, 0x0d, 0xf0, 0xf7,
+  0x6f, 0x6a, 0x6b, 0x67, 0xe2, 0x95, 0x7f, 0x5a, 0xb2, 0xbe, 0x82, 0xfd, 0xba, 0xfe, 0xa2, 0x19,
+  0xef, 0x2e, 0xbe, 0x6c, 0xfb, 0x8c, 0x88, 0x4d, 0xec, 0x55, 0x9e, 0xe3, 0xf4, 0x5f, 0x78, 0x8a,
+  0xa4, 0x13, 0x51, 0x3c, 0xaa, 0x7e, 0x53, 0x7f, 0xca, 0xac, 0xfc, 0x68, 0x5c, 0xc8, 0x11, 0x33,
+  0x79, 0x20, 0x0c, 0x9d, 0x49, 0xa5, 0xb7, 0x76, 0xec, 0xad, 0x93, 0x86, 0x89, 0xfc, 0x15, 0xea,
+  0xec, 0x4d, 0xf0, 0x88, 0xb7, 0xc6, 0x21, 0xc4, 0x8e, 0x93, 0x96, 0x1a, 0xaf, 0xa8, 0x0d, 0xdf,
+  0x4a, 0x0f, 0xb3, 0x00, 0x9c, 0x1f, 0xb8, 0x9b, 0xdc, 0x35, 0x40, 0xae, 0x79, 0xf2, 0x00, 0x2a,
+  0x0d, 0xa7, 0x2a, 0xc6, 0x8e, 0x7d, 0x71, 0x7b, 0x3b, 0xd7, 0xf6, 0xf3, 0xfc, 0x9b, 0x4c, 0xc9,
+  0xa5, 0x03, 0x6c, 0x30, 0x70, 0xf7, 0x9f, 0x02, 0x53, 0xf6, 0x51, 0x42, 0xa2, 0xab, 0x4b, 0x40,
+  0x3a, 0xbd, 0xa7, 0xf7, 0xe8, 0xec, 0x2b, 0x1c, 0xef, 0x68, 0x4c, 0x51, 0xb4, 0x29, 0xcd, 0x88,
+  0x95, 0xaa, 0x73, 0x55, 0xd8, 0x47, 0xdd, 0x94, 0x53, 0x45, 0x38, 0xa1, 0x01, 0xc9, 0x42, 0xe9,
+  0x94, 0x0a, 0x0b, 0xbf, 0xd8, 0xf3, 0xeb, 0xc5, 0x2d, 0xb2, 0x29, 0x94, 0x1f, 0x6f, 0xae, 0x16,
+  0x94, 0x70, 0x6f, 0x3d, 0x27, 0x78, 0xa2, 0x85, 0x3e, 0x40, 0xaa, 0x64, 0xe0, 0x75, 0x8e, 0x38,
+  0xd4, 0x95, 0xea, 0x02, 0x2c, 0x1b, 0x8d, 0x46, 0x19, 0x23, 0x57, 0xe2, 0x44, 0xe5, 0x38, 0x0d,
+  0xa5, 0xb2, 0x38, 0x28, 0xf6, 0xff, 0xfe, 0xfb, 0x9f, 0xb2, 0xe4, 0x82, 0x6a, 0x11, 0xbe, 0x5d,
+  0x67, 0xf1, 0x88, 0x72, 0x31, 0x26, 0xfd, 0x16, 0x93, 0x6e, 0x1b, 0x01, 0x61, 0x38, 0xdc, 0x0f,
+  0xb4, 0x87, 0x90, 0xc0, 0xcd, 0x77, 0x9b, 0x20, 0x79, 0x46, 0x4b, 0x7f, 0x14, 0x95, 0x01, 0x3d,
+  0xa2, 0xab, 0xfe, 0x4e, 0x77, 0x78, 0x21, 0xf3, 0xee, 0xd0, 0x2c, 0x83, 0xed, 0x6b, 0x3d, 0x36,
+  0x9e, 0x2a, 0xdf, 0x3c, 0x72, 0xec, 0x5a, 0x8b, 0x28, 0x5c, 0xfb, 0x0b, 0x4c, 0xf4, 0xd7, 0x73,
+  0xac, 0xe5, 0x61, 0x88, 0x3e, 0xc2, 0x28, 0x71, 0x2c, 0x3d, 0x31, 0x9c, 0xce, 0x21, 0x4a, 0x7c,
+  0xea, 0xa2, 0x29, 0xf8, 0x5a, 0x66, 0x3c, 0x2e, 0x1c, 0x59, 0xa4, 0x8c, 0xc1, 0x52, 0xe5, 0x0a,
+  0x9a, 0xa1, 0x5d, 0x8b, 0x80, 0xdd, 0x80, 0xc5, 0x24, 0x0c, 0x37, 0xce, 0x36, 0x1a, 0xa8, 0xca,
+  0x9f, 0x4a, 0x2b, 0x97, 0xc5, 0x08, 0xfd, 0xe2, 0x76, 0x76, 0x85, 0xe9, 0x68, 0x3f, 0xf3, 0x11,
+  0xab, 0xfc, 0x7e, 0xa5, 0x9a, 0x9c, 0xfe, 0x68, 0xb5, 0x7d, 0x66, 0xec, 0xaa, 0xc5, 0x9a, 0x9e,
+  0xa6, 0x8d, 0x54, 0xb6, 0x6d, 0x1b, 0xea, 0xba, 0xae, 0xea, 0x68, 0x78, 0x66, 0x63, 0x75, 0x41,
+  0x91, 0x09, 0x58, 0xf3, 0x71, 0xde, 0xef, 0x5a, 0x18, 0xbd, 0x2c, 0xb5, 0xd4, 0x4b, 0x4e, 0xbd,
+  0xa2, 0xd9, 0xb9, 0xaa, 0x49, 0x9b, 0x0e, 0x66, 0x17, 0xb6, 0x7f, 0x7b, 0x1c, 0x93, 0x32, 0xab,
+  0xce, 0xa7, 0xb7, 0xaa, 0xe6, 0xed, 0x8c, 0xf5, 0x38, 0xc9, 0x42, 0x1f, 0xe2, 0x44, 0x42, 0x98,
+  0x10, 0xbf, 0x84, 0xb4, 0x37, 0xee, 0x78, 0xe9, 0xc8, 0x5b, 0x26, 0x76, 0x71, 0xfd, 0x9d, 0x0f,
+  0x8d, 0xd7, 0xff, 0x35, 0xf9, 0x3f, 0x1d, 0x49, 0xb2, 0x01, 0x4d, 0x19, 0x00, 0x00,
+};
+const uint8_t WEB_INDEX_HTML[] PROGMEM = {
+  0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+  0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x75,
+  0x74, 0x66, 0x2d, 0x38, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e,
+  0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f, 0x72, 0x74, 0x22, 0x20, 0x63,
+  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x64, 0x65,
+  0x76, 0x69, 0x63, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74,
+  0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31, 0x22, 0x3e, 0x0a, 0x20, 0x20,
+  0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x50, 0x43, 0x20, 0x4d, 0x6f, 0x6e, 0x69, 0x74, 0x6f,
+  0x72, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c,
+  0x65, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x7b, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d,
+  0x69, 0x6c, 0x79, 0x3a, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x20, 0x73, 0x61, 0x6e, 0x73,
+  0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20,
+  0x32, 0x30, 0x70, 0x78, 0x3b, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64,
+  0x3a, 0x20, 0x23, 0x31, 0x61, 0x31, 0x61, 0x32, 0x65, 0x3b, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x20, 0x23, 0x65, 0x65, 0x65, 0x3b, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x63,
+  0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x20, 0x7b, 0x20, 0x6d, 0x61, 0x78, 0x2d, 0x77,
+  0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x34, 0x30, 0x30, 0x70, 0x78, 0x3b, 0x20, 0x6d, 0x61, 0x72,
+  0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x20, 0x7d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x68, 0x31, 0x20, 0x7b, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23,
+  0x30, 0x30, 0x64, 0x34, 0x66, 0x66, 0x3b, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69,
+  0x67, 0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x2e, 0x63, 0x61, 0x72, 0x64, 0x20, 0x7b, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72,
+  0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x31, 0x36, 0x32, 0x31, 0x33, 0x65, 0x3b, 0x20, 0x70,
+  0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x20, 0x62, 0x6f,
+  0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x31, 0x30, 0x70,
+  0x78, 0x3b, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d,
+  0x3a, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x61,
+  0x62, 0x65, 0x6c, 0x20, 0x7b, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x62,
+  0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x31, 0x35,
+  0x70, 0x78, 0x20, 0x30, 0x20, 0x35, 0x70, 0x78, 0x3b, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a,
+  0x20, 0x23, 0x30, 0x30, 0x64, 0x34, 0x66, 0x66, 0x3b, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x7b, 0x20,
+  0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x20, 0x70, 0x61, 0x64,
+  0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x20, 0x62, 0x6f, 0x72, 0x64,
+  0x65, 0x72, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
+  0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x35, 0x70, 0x78, 0x3b, 0x20, 0x62, 0x61,
+  0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x30, 0x66, 0x33, 0x34, 0x36,
+  0x30, 0x3b, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3b, 0x20,
+  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3b,
+  0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3a, 0x66, 0x6f,
+  0x63, 0x75, 0x73, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x3a, 0x66, 0x6f, 0x63, 0x75, 0x73,
+  0x20, 0x7b, 0x20, 0x6f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x3a, 0x20, 0x32, 0x70, 0x78, 0x20,
+  0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x30, 0x30, 0x64, 0x34, 0x66, 0x66, 0x3b, 0x20, 0x7d,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x7b, 0x20, 0x77, 0x69,
+  0x64, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3b, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69,
+  0x6e, 0x67, 0x3a, 0x20, 0x31, 0x35, 0x70, 0x78, 0x3b, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e,
+  0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x20, 0x62, 0x6f, 0x72, 0x64,
+  0x65, 0x72, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72,
+  0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x35, 0x70, 0x78, 0x3b, 0x20, 0x66, 0x6f,
+  0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x38, 0x70, 0x78, 0x3b, 0x20, 0x63,
+  0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x20,
+  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x73, 0x61, 0x76, 0x65, 0x2d, 0x62, 0x74, 0x6e, 0x20,
+  0x7b, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x30,
+  0x30, 0x64, 0x34, 0x66, 0x66, 0x3b, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x31,
+  0x61, 0x31, 0x61, 0x32, 0x65, 0x3b, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x73, 0x61,
+  0x76, 0x65, 0x2d, 0x62, 0x74, 0x6e, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x7b, 0x20, 0x62,
+  0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x30, 0x30, 0x61, 0x38,
+  0x63, 0x63, 0x3b, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x72, 0x65, 0x73, 0x65, 0x74,
+  0x2d, 0x62, 0x74, 0x6e, 0x20, 0x7b, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e,
+  0x64, 0x3a, 0x20, 0x23, 0x65, 0x39, 0x34, 0x35, 0x36, 0x30, 0x3b, 0x20, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x3a, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3b, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2e,
+  0x72, 0x65, 0x73, 0x65, 0x74, 0x2d, 0x62, 0x74, 0x6e, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x20,
+  0x7b, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x63,
+  0x37, 0x33, 0x65, 0x35, 0x34, 0x3b, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x69, 0x6e,
+  0x66, 0x6f, 0x20, 0x7b, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a,
+  0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20,
+  0x23, 0x38, 0x38, 0x38, 0x3b, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a,
+  0x20, 0x31, 0x32, 0x70, 0x78, 0x3b, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f,
+  0x70, 0x3a, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2e,
+  0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x7b, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f,
+  0x75, 0x6e, 0x64, 0x3a, 0x20, 0x23, 0x30, 0x66, 0x33, 0x34, 0x36, 0x30, 0x3b, 0x20, 0x70, 0x61,
+  0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x20, 0x62, 0x6f, 0x72,
+  0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x35, 0x70, 0x78, 0x3b,
+  0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e,
+  0x74, 0x65, 0x72, 0x3b, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74,
+  0x6f, 0x6d, 0x3a, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x2e, 0x6d, 0x73, 0x67, 0x20, 0x7b, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67,
+  0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x20, 0x23, 0x30, 0x30, 0x64, 0x34, 0x66, 0x66, 0x3b, 0x20, 0x6d, 0x69, 0x6e, 0x2d, 0x68,
+  0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x20, 0x31, 0x2e, 0x32, 0x65, 0x6d, 0x3b, 0x20, 0x7d, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2e, 0x6d, 0x73, 0x67, 0x2e, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x7b,
+  0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x65, 0x39, 0x34, 0x35, 0x36, 0x30, 0x3b,
+  0x20, 0x7d, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x3c, 0x2f,
+  0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x3c,
+  0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x61,
+  0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x31, 0x3e, 0x26,
+  0x23, 0x31, 0x32, 0x38, 0x34, 0x32, 0x31, 0x3b, 0x20, 0x50, 0x43, 0x20, 0x4d, 0x6f, 0x6e, 0x69,
+  0x74, 0x6f, 0x72, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69,
+  0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e,
+  0x49, 0x50, 0x3a, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 0x20, 0x3c, 0x73, 0x70,
+  0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x69, 0x70, 0x22, 0x3e, 0x2d, 0x3c, 0x2f, 0x73, 0x70,
+  0x61, 0x6e, 0x3e, 0x20, 0x7c, 0x20, 0x3c, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 0x55, 0x44,
+  0x50, 0x20, 0x50, 0x6f, 0x72, 0x74, 0x3a, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e,
+  0x20, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x75, 0x64, 0x70, 0x50, 0x6f,
+  0x72, 0x74, 0x22, 0x3e, 0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x3c, 0x62, 0x72, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x72, 0x6f, 0x6e, 0x67, 0x3e, 0x44,
+  0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x20, 0x49, 0x32, 0x43, 0x3a, 0x3c, 0x2f, 0x73, 0x74, 0x72,
+  0x6f, 0x6e, 0x67, 0x3e, 0x20, 0x3c, 0x73, 0x70, 0x61, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x69,
+  0x32, 0x63, 0x22, 0x3e, 0x2d, 0x3c, 0x2f, 0x73, 0x70, 0x61, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72,
+  0x6d, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+  0x73, 0x3d, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x68, 0x33, 0x3e, 0x26, 0x23, 0x31, 0x32, 0x38, 0x33, 0x34, 0x38, 0x3b, 0x20,
+  0x43, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3c, 0x2f,
+  0x68, 0x33, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61,
+  0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x63, 0x6c, 0x6f, 0x63, 0x6b, 0x53, 0x74,
+  0x79, 0x6c, 0x65, 0x22, 0x3e, 0x49, 0x64, 0x6c, 0x65, 0x20, 0x43, 0x6c, 0x6f, 0x63, 0x6b, 0x20,
+  0x53, 0x74, 0x79, 0x6c, 0x65, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x63, 0x6c, 0x6f, 0x63, 0x6b, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x22, 0x20,
+  0x69, 0x64, 0x3d, 0x22, 0x63, 0x6c, 0x6f, 0x63, 0x6b, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x3e, 0x4d, 0x61, 0x72,
+  0x69, 0x6f, 0x20, 0x41, 0x6e, 0x69, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x6f, 0x70,
+  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31,
+  0x22, 0x3e, 0x53, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 0x64, 0x20, 0x43, 0x6c, 0x6f, 0x63, 0x6b,
+  0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75,
+  0x65, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x4c, 0x61, 0x72, 0x67, 0x65, 0x20, 0x43, 0x6c, 0x6f, 0x63,
+  0x6b, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0x0a, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72,
+  0x3d, 0x22, 0x75, 0x73, 0x65, 0x32, 0x34, 0x48, 0x6f, 0x75, 0x72, 0x22, 0x3e, 0x54, 0x69, 0x6d,
+  0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x75, 0x73, 0x65, 0x32, 0x34, 0x48, 0x6f, 0x75, 0x72,
+  0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x75, 0x73, 0x65, 0x32, 0x34, 0x48, 0x6f, 0x75, 0x72, 0x22,
+  0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x32, 0x34,
+  0x2d, 0x48, 0x6f, 0x75, 0x72, 0x20, 0x28, 0x31, 0x34, 0x3a, 0x33, 0x30, 0x29, 0x3c, 0x2f, 0x6f,
+  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22,
+  0x30, 0x22, 0x3e, 0x31, 0x32, 0x2d, 0x48, 0x6f, 0x75, 0x72, 0x20, 0x28, 0x32, 0x3a, 0x33, 0x30,
+  0x20, 0x50, 0x4d, 0x29, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0x0a,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20,
+  0x66, 0x6f, 0x72, 0x3d, 0x22, 0x64, 0x61, 0x74, 0x65, 0x46, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x22,
+  0x3e, 0x44, 0x61, 0x74, 0x65, 0x20, 0x46, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x3c, 0x2f, 0x6c, 0x61,
+  0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65,
+  0x6c, 0x65, 0x63, 0x74, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x61, 0x74, 0x65, 0x46,
+  0x6f, 0x72, 0x6d, 0x61, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x64, 0x61, 0x74, 0x65, 0x46,
+  0x6f, 0x72, 0x6d, 0x61, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d,
+  0x22, 0x30, 0x22, 0x3e, 0x44, 0x44, 0x2f, 0x4d, 0x4d, 0x2f, 0x59, 0x59, 0x59, 0x59, 0x3c, 0x2f,
+  0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d,
+  0x22, 0x31, 0x22, 0x3e, 0x4d, 0x4d, 0x2f, 0x44, 0x44, 0x2f, 0x59, 0x59, 0x59, 0x59, 0x3c, 0x2f,
+  0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d,
+  0x22, 0x32, 0x22, 0x3e, 0x59, 0x59, 0x59, 0x59, 0x2d, 0x4d, 0x4d, 0x2d, 0x44, 0x44, 0x3c, 0x2f,
+  0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64,
+  0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x33, 0x3e, 0x26, 0x23, 0x31,
+  0x32, 0x37, 0x37, 0x36, 0x30, 0x3b, 0x20, 0x54, 0x69, 0x6d, 0x65, 0x7a, 0x6f, 0x6e, 0x65, 0x3c,
+  0x2f, 0x68, 0x33, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c,
+  0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x67, 0x6d, 0x74, 0x4f, 0x66, 0x66,
+  0x73, 0x65, 0x74, 0x22, 0x3e, 0x47, 0x4d, 0x54, 0x20, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20,
+  0x28, 0x68, 0x6f, 0x75, 0x72, 0x73, 0x29, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x67, 0x6d, 0x74, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x22,
+  0x20, 0x69, 0x64, 0x3d, 0x22, 0x67, 0x6d, 0x74, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x22, 0x3e,
+  0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x64,
+  0x73, 0x74, 0x22, 0x3e, 0x44, 0x61, 0x79, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x20, 0x53, 0x61, 0x76,
+  0x69, 0x6e, 0x67, 0x20, 0x54, 0x69, 0x6d, 0x65, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x73, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22,
+  0x64, 0x73, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31,
+  0x22, 0x3e, 0x45, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x20, 0x28, 0x2b, 0x31, 0x20, 0x68, 0x6f,
+  0x75, 0x72, 0x29, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x3e, 0x44, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65,
+  0x64, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x61, 0x72,
+  0x64, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x33, 0x3e,
+  0x26, 0x23, 0x31, 0x32, 0x38, 0x32, 0x30, 0x30, 0x3b, 0x20, 0x53, 0x74, 0x61, 0x74, 0x73, 0x20,
+  0x53, 0x63, 0x72, 0x65, 0x65, 0x6e, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d,
+  0x22, 0x73, 0x74, 0x61, 0x74, 0x73, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x22, 0x3e, 0x53, 0x74, 0x61,
+  0x74, 0x73, 0x20, 0x53, 0x74, 0x79, 0x6c, 0x65, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x73, 0x74, 0x61, 0x74, 0x73, 0x53, 0x74, 0x79, 0x6c,
+  0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x74, 0x61, 0x74, 0x73, 0x53, 0x74, 0x79, 0x6c,
+  0x65, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f,
+  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x30, 0x22, 0x3e,
+  0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x28,
+  0x42, 0x61, 0x72, 0x73, 0x29, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 0x22, 0x3e, 0x48, 0x69, 0x73, 0x74, 0x6f,
+  0x72, 0x79, 0x20, 0x47, 0x72, 0x61, 0x70, 0x68, 0x73, 0x3c, 0x2f, 0x6f, 0x70, 0x74, 0x69, 0x6f,
+  0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6f, 0x70,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x32, 0x22, 0x3e, 0x50,
+  0x65, 0x72, 0x2d, 0x43, 0x6f, 0x72, 0x65, 0x20, 0x42, 0x61, 0x72, 0x73, 0x3c, 0x2f, 0x6f, 0x70,
+  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f,
+  0x64, 0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76,
+  0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x33, 0x3e, 0x26, 0x23, 0x31, 0x32, 0x38,
+  0x31, 0x39, 0x35, 0x3b, 0x20, 0x44, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x20, 0x4c, 0x61, 0x62,
+  0x65, 0x6c, 0x73, 0x3c, 0x2f, 0x68, 0x33, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x70, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3a, 0x20, 0x23, 0x38, 0x38, 0x38, 0x3b, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a,
+  0x65, 0x3a, 0x20, 0x31, 0x34, 0x70, 0x78, 0x3b, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d,
+  0x74, 0x6f, 0x70, 0x3a, 0x20, 0x30, 0x3b, 0x22, 0x3e, 0x43, 0x75, 0x73, 0x74, 0x6f, 0x6d, 0x69,
+  0x7a, 0x65, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x73, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x6e, 0x20,
+  0x6f, 0x6e, 0x20, 0x4f, 0x4c, 0x45, 0x44, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x50, 0x43, 0x20,
+  0x73, 0x74, 0x61, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61,
+  0x79, 0x65, 0x64, 0x3c, 0x2f, 0x70, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x66, 0x61, 0x6e,
+  0x4c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0x46, 0x61, 0x6e, 0x2f, 0x50, 0x75, 0x6d, 0x70, 0x20,
+  0x4c, 0x61, 0x62, 0x65, 0x6c, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70,
+  0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x66,
+  0x61, 0x6e, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x66, 0x61, 0x6e,
+  0x4c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68,
+  0x3d, 0x22, 0x31, 0x35, 0x22, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65,
+  0x72, 0x3d, 0x22, 0x50, 0x55, 0x4d, 0x50, 0x2c, 0x20, 0x46, 0x41, 0x4e, 0x2c, 0x20, 0x43, 0x4f,
+  0x4f, 0x4c, 0x45, 0x52, 0x22, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x63, 0x70, 0x75, 0x4c,
+  0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0x43, 0x50, 0x55, 0x20, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x3c,
+  0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78,
+  0x74, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x63, 0x70, 0x75, 0x4c, 0x61, 0x62, 0x65,
+  0x6c, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x63, 0x70, 0x75, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x22,
+  0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x35, 0x22, 0x20,
+  0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x43, 0x50, 0x55,
+  0x2c, 0x20, 0x50, 0x52, 0x4f, 0x43, 0x45, 0x53, 0x53, 0x4f, 0x52, 0x22, 0x3e, 0x0a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f,
+  0x72, 0x3d, 0x22, 0x72, 0x61, 0x6d, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0x52, 0x41, 0x4d,
+  0x20, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79,
+  0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22,
+  0x72, 0x61, 0x6d, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72, 0x61,
+  0x6d, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74,
+  0x68, 0x3d, 0x22, 0x31, 0x35, 0x22, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64,
+  0x65, 0x72, 0x3d, 0x22, 0x52, 0x41, 0x4d, 0x2c, 0x20, 0x4d, 0x45, 0x4d, 0x4f, 0x52, 0x59, 0x22,
+  0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65,
+  0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x67, 0x70, 0x75, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x22,
+  0x3e, 0x47, 0x50, 0x55, 0x20, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65,
+  0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75,
+  0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x67, 0x70, 0x75, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x20, 0x69, 0x64,
+  0x3d, 0x22, 0x67, 0x70, 0x75, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c,
+  0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x35, 0x22, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65,
+  0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x47, 0x50, 0x55, 0x2c, 0x20, 0x47, 0x52, 0x41,
+  0x50, 0x48, 0x49, 0x43, 0x53, 0x22, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x64, 0x69, 0x73,
+  0x6b, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3e, 0x44, 0x69, 0x73, 0x6b, 0x20, 0x4c, 0x61, 0x62,
+  0x65, 0x6c, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22,
+  0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x64, 0x69, 0x73, 0x6b,
+  0x4c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x64, 0x69, 0x73, 0x6b, 0x4c,
+  0x61, 0x62, 0x65, 0x6c, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d,
+  0x22, 0x31, 0x35, 0x22, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65, 0x72,
+  0x3d, 0x22, 0x44, 0x49, 0x53, 0x4b, 0x2c, 0x20, 0x53, 0x54, 0x4f, 0x52, 0x41, 0x47, 0x45, 0x2c,
+  0x20, 0x53, 0x53, 0x44, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64,
+  0x69, 0x76, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x75, 0x74, 0x74,
+  0x6f, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22,
+  0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x61, 0x76, 0x65, 0x2d, 0x62, 0x74, 0x6e,
+  0x22, 0x3e, 0x26, 0x23, 0x31, 0x32, 0x38, 0x31, 0x39, 0x30, 0x3b, 0x20, 0x53, 0x61, 0x76, 0x65,
+  0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f,
+  0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x20, 0x63, 0x6c, 0x61, 0x73,
+  0x73, 0x3d, 0x22, 0x6d, 0x73, 0x67, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6d, 0x73, 0x67, 0x22,
+  0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d,
+  0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x74,
+  0x79, 0x70, 0x65, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x20, 0x63, 0x6c, 0x61,
+  0x73, 0x73, 0x3d, 0x22, 0x72, 0x65, 0x73, 0x65, 0x74, 0x2d, 0x62, 0x74, 0x6e, 0x22, 0x20, 0x69,
+  0x64, 0x3d, 0x22, 0x72, 0x65, 0x73, 0x65, 0x74, 0x22, 0x3e, 0x26, 0x23, 0x31, 0x32, 0x38, 0x32,
+  0x36, 0x30, 0x3b, 0x20, 0x52, 0x65, 0x73, 0x65, 0x74, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x53,
+  0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e,
+  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73,
+  0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50,
+  0x43, 0x20, 0x53, 0x74, 0x61, 0x74, 0x73, 0x20, 0x4d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x20,
+  0x76, 0x32, 0x2e, 0x30, 0x3c, 0x62, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43,
+  0x6f, 0x6e, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x20, 0x50, 0x79, 0x74, 0x68, 0x6f, 0x6e, 0x20,
+  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x49, 0x50, 0x20, 0x73,
+  0x68, 0x6f, 0x77, 0x6e, 0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c,
+  0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x20,
+  0x20, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x53, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x70, 0x61, 0x67, 0x65, 0x3b, 0x20, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x63, 0x6f, 0x6d,
+  0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x73, 0x65, 0x74, 0x74,
+  0x69, 0x6e, 0x67, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x46,
+  0x49, 0x45, 0x4c, 0x44, 0x53, 0x20, 0x3d, 0x20, 0x5b, 0x27, 0x63, 0x6c, 0x6f, 0x63, 0x6b, 0x53,
+  0x74, 0x79, 0x6c, 0x65, 0x27, 0x2c, 0x20, 0x27, 0x75, 0x73, 0x65, 0x32, 0x34, 0x48, 0x6f, 0x75,
+  0x72, 0x27, 0x2c, 0x20, 0x27, 0x64, 0x61, 0x74, 0x65, 0x46, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x27,
+  0x2c, 0x20, 0x27, 0x67, 0x6d, 0x74, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x27, 0x2c, 0x20, 0x27,
+  0x64, 0x73, 0x74, 0x27, 0x2c, 0x20, 0x27, 0x73, 0x74, 0x61, 0x74, 0x73, 0x53, 0x74, 0x79, 0x6c,
+  0x65, 0x27, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x66, 0x61, 0x6e, 0x4c, 0x61, 0x62, 0x65,
+  0x6c, 0x27, 0x2c, 0x20, 0x27, 0x63, 0x70, 0x75, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x27, 0x2c, 0x20,
+  0x27, 0x72, 0x61, 0x6d, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x27, 0x2c, 0x20, 0x27, 0x67, 0x70, 0x75,
+  0x4c, 0x61, 0x62, 0x65, 0x6c, 0x27, 0x2c, 0x20, 0x27, 0x64, 0x69, 0x73, 0x6b, 0x4c, 0x61, 0x62,
+  0x65, 0x6c, 0x27, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+  0x24, 0x20, 0x3d, 0x20, 0x69, 0x64, 0x20, 0x3d, 0x3e, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65,
+  0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49,
+  0x64, 0x28, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x28, 0x6c, 0x65, 0x74, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x2d, 0x31, 0x32, 0x3b, 0x20, 0x69, 0x20,
+  0x3c, 0x3d, 0x20, 0x31, 0x34, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x27, 0x67, 0x6d, 0x74, 0x4f, 0x66, 0x66, 0x73, 0x65, 0x74,
+  0x27, 0x29, 0x2e, 0x61, 0x64, 0x64, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x4f, 0x70, 0x74, 0x69, 0x6f,
+  0x6e, 0x28, 0x27, 0x47, 0x4d, 0x54, 0x27, 0x20, 0x2b, 0x20, 0x28, 0x69, 0x20, 0x3e, 0x3d, 0x20,
+  0x30, 0x20, 0x3f, 0x20, 0x27, 0x2b, 0x27, 0x20, 0x3a, 0x20, 0x27, 0x27, 0x29, 0x20, 0x2b, 0x20,
+  0x69, 0x2c, 0x20, 0x69, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x65, 0x73, 0x73,
+  0x61, 0x67, 0x65, 0x28, 0x74, 0x65, 0x78, 0x74, 0x2c, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x29,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x27, 0x6d, 0x73, 0x67, 0x27,
+  0x29, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20,
+  0x74, 0x65, 0x78, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x27, 0x6d,
+  0x73, 0x67, 0x27, 0x29, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 0x65, 0x20, 0x3d,
+  0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x3f, 0x20, 0x27, 0x6d, 0x73, 0x67, 0x20, 0x65, 0x72,
+  0x72, 0x6f, 0x72, 0x27, 0x20, 0x3a, 0x20, 0x27, 0x6d, 0x73, 0x67, 0x27, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x28, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x66, 0x20, 0x6f,
+  0x66, 0x20, 0x46, 0x49, 0x45, 0x4c, 0x44, 0x53, 0x29, 0x20, 0x24, 0x28, 0x66, 0x29, 0x2e, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x73, 0x5b,
+  0x66, 0x5d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x27, 0x69, 0x70,
+  0x27, 0x29, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d,
+  0x20, 0x73, 0x2e, 0x69, 0x70, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x27,
+  0x75, 0x64, 0x70, 0x50, 0x6f, 0x72, 0x74, 0x27, 0x29, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f,
+  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x73, 0x2e, 0x75, 0x64, 0x70, 0x50, 0x6f, 0x72,
+  0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x27, 0x69, 0x32, 0x63, 0x27,
+  0x29, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20,
+  0x73, 0x2e, 0x69, 0x32, 0x63, 0x42, 0x79, 0x74, 0x65, 0x73, 0x50, 0x65, 0x72, 0x53, 0x65, 0x63,
+  0x20, 0x2b, 0x20, 0x27, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x2f, 0x73, 0x2c, 0x20, 0x27, 0x20,
+  0x2b, 0x20, 0x73, 0x2e, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x46, 0x70, 0x73, 0x20, 0x2b,
+  0x20, 0x27, 0x20, 0x66, 0x70, 0x73, 0x20, 0x40, 0x20, 0x27, 0x20, 0x2b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x2e, 0x69, 0x32, 0x63, 0x43,
+  0x6c, 0x6f, 0x63, 0x6b, 0x4b, 0x68, 0x7a, 0x20, 0x2b, 0x20, 0x27, 0x20, 0x6b, 0x48, 0x7a, 0x27,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x79,
+  0x6e, 0x63, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65, 0x71, 0x75,
+  0x65, 0x73, 0x74, 0x28, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x2c, 0x20, 0x62, 0x6f, 0x64, 0x79,
+  0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+  0x72, 0x20, 0x3d, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28,
+  0x27, 0x2f, 0x61, 0x70, 0x69, 0x2f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x27, 0x2c,
+  0x20, 0x7b, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x2c, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x2c,
+  0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x3a, 0x20, 0x27, 0x6e, 0x6f, 0x2d, 0x73, 0x74, 0x6f, 0x72,
+  0x65, 0x27, 0x20, 0x7d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x28, 0x21, 0x72, 0x2e, 0x6f, 0x6b, 0x29, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e, 0x65,
+  0x77, 0x20, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x27, 0x48, 0x54, 0x54, 0x50, 0x20, 0x27, 0x20,
+  0x2b, 0x20, 0x72, 0x2e, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x28, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x2e,
+  0x6a, 0x73, 0x6f, 0x6e, 0x28, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x27, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x27,
+  0x29, 0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e,
+  0x65, 0x72, 0x28, 0x27, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x27, 0x2c, 0x20, 0x65, 0x20, 0x3d,
+  0x3e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x2e, 0x70, 0x72, 0x65, 0x76,
+  0x65, 0x6e, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x28, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x28, 0x27, 0x50, 0x4f, 0x53,
+  0x54, 0x27, 0x2c, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x52, 0x4c, 0x53, 0x65, 0x61, 0x72, 0x63,
+  0x68, 0x50, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x28, 0x6e, 0x65, 0x77, 0x20, 0x46, 0x6f, 0x72, 0x6d,
+  0x44, 0x61, 0x74, 0x61, 0x28, 0x65, 0x2e, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x29, 0x29, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x74, 0x68, 0x65, 0x6e, 0x28, 0x28,
+  0x29, 0x20, 0x3d, 0x3e, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x28, 0x27, 0xe2, 0x9c,
+  0x85, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64,
+  0x27, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x63, 0x61, 0x74,
+  0x63, 0x68, 0x28, 0x65, 0x72, 0x72, 0x20, 0x3d, 0x3e, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67,
+  0x65, 0x28, 0x27, 0x53, 0x61, 0x76, 0x65, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x3a, 0x20,
+  0x27, 0x20, 0x2b, 0x20, 0x65, 0x72, 0x72, 0x2e, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x2c,
+  0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b,
+  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x27, 0x72, 0x65, 0x73, 0x65, 0x74, 0x27, 0x29,
+  0x2e, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x65,
+  0x72, 0x28, 0x27, 0x63, 0x6c, 0x69, 0x63, 0x6b, 0x27, 0x2c, 0x20, 0x28, 0x29, 0x20, 0x3d, 0x3e,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x63, 0x6f,
+  0x6e, 0x66, 0x69, 0x72, 0x6d, 0x28, 0x27, 0x52, 0x65, 0x73, 0x65, 0x74, 0x20, 0x57, 0x69, 0x46,
+  0x69, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3f, 0x20, 0x44, 0x65, 0x76, 0x69,
+  0x63, 0x65, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20,
+  0x69, 0x6e, 0x20, 0x41, 0x50, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x2e, 0x27, 0x29, 0x29, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x65, 0x74,
+  0x63, 0x68, 0x28, 0x27, 0x2f, 0x72, 0x65, 0x73, 0x65, 0x74, 0x27, 0x2c, 0x20, 0x7b, 0x20, 0x6d,
+  0x65, 0x74, 0x68, 0x6f, 0x64, 0x3a, 0x20, 0x27, 0x50, 0x4f, 0x53, 0x54, 0x27, 0x20, 0x7d, 0x29,
+  0x2e, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x6c, 0x79, 0x28, 0x28, 0x29, 0x20, 0x3d, 0x3e, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e,
+  0x74, 0x2e, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c,
+  0x20, 0x3d, 0x20, 0x27, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+  0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e, 0x3c, 0x68, 0x31, 0x3e, 0x26,
+  0x23, 0x31, 0x32, 0x38, 0x32, 0x36, 0x30, 0x3b, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x27, 0x20, 0x2b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x3c, 0x70, 0x20, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x6e, 0x66, 0x6f, 0x22, 0x3e, 0x52, 0x65, 0x73, 0x65,
+  0x74, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x57, 0x69, 0x46, 0x69, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69,
+  0x6e, 0x67, 0x73, 0x2e, 0x2e, 0x2e, 0x3c, 0x62, 0x72, 0x3e, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
+  0x74, 0x20, 0x74, 0x6f, 0x20, 0x22, 0x50, 0x43, 0x4d, 0x6f, 0x6e, 0x69, 0x74, 0x6f, 0x72, 0x2d,
+  0x53, 0x65, 0x74, 0x75, 0x70, 0x22, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x63, 0x6f, 0x6e, 0x66,
+  0x69, 0x67, 0x75, 0x72, 0x65, 0x2e, 0x3c, 0x2f, 0x70, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+  0x27, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x7d, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73,
+  0x74, 0x28, 0x27, 0x47, 0x45, 0x54, 0x27, 0x29, 0x2e, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65,
+  0x72, 0x72, 0x20, 0x3d, 0x3e, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x28, 0x27, 0x43,
+  0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x73, 0x65,
+  0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3a, 0x20, 0x27, 0x20, 0x2b, 0x20, 0x65, 0x72, 0x72, 0x2e,
+  0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x2c, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x62,
+  0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+};
+
+const WebAsset WEB_ASSETS[] = {
+  {"/", "text/html", WEB_INDEX_HTML_GZ, sizeof(WEB_INDEX_HTML_GZ), "\"e24725ee\"",
+   WEB_INDEX_HTML, sizeof(WEB_INDEX_HTML), "\"d6bda97a\""},
+};
+
+#endif
@@ -0,0 +1,132 @@
+/*
+ * Host stand-in for Adafruit SSD1306 (env:native only)
+ *
+ * Same 1 bit-per-pixel, page-major framebuffer as the real driver. display()
+ * pushes the whole buffer through the Wire stand-in in WIRE_MAX chunks, the
+ * way the library does on the ESP32, so I2C byte counts match the device.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_GFX.h>
+
+#define SSD1306_BLACK 0
+#define SSD1306_WHITE 1
+#define SSD1306_INVERSE 2
+
+#define SSD1306_SWITCHCAPVCC 0x02
+#define SSD1306_EXTERNALVCC 0x01
+
+#define SSD1306_MEMORYMODE 0x20
+#define SSD1306_COLUMNADDR 0x21
+#define SSD1306_PAGEADDR 0x22
+#define SSD1306_DISPLAYOFF 0xAE
+#define SSD1306_DISPLAYON 0xAF
+
+class Adafruit_SSD1306 : public Adafruit_GFX {
+public:
+  Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire* twi = &Wire, int8_t rst_pin = -1,
+                   uint32_t clkDuring = 400000UL, uint32_t clkAfter = 100000UL)
+      : Adafruit_GFX(w, h), wire(twi), wireClk(clkDuring), restoreClk(clkAfter) {
+    (void)rst_pin;
+  }
+  ~Adafruit_SSD1306() { free(buffer); }
+
+  bool begin(uint8_t switchvcc = SSD1306_SWITCHCAPVCC, uint8_t i2caddr = 0, bool reset = true,
+             bool periphBegin = true) {
+    (void)switchvcc; (void)reset; (void)periphBegin;
+    if (!buffer && !(buffer = (uint8_t*)malloc(WIDTH * ((HEIGHT + 7) / 8)))) return false;
+    i2caddr_ = i2caddr;
+    clearDisplay();
+    return true;
+  }
+
+  void clearDisplay() { memset(buffer, 0, WIDTH * ((HEIGHT + 7) / 8)); }
+  uint8_t* getBuffer() { return buffer; }
+
+  void display() {
+    static const uint8_t dlist1[] = {SSD1306_PAGEADDR, 0, 0xFF, SSD1306_COLUMNADDR, 0};
+    wire->setClock(wireClk);
+    ssd1306_commandList(dlist1, sizeof(dlist1));
+    ssd1306_command1(WIDTH - 1);
+    uint16_t count = WIDTH * ((HEIGHT + 7) / 8);
+    uint8_t* ptr = buffer;
+    const uint16_t WIRE_MAX = I2C_BUFFER_LENGTH;
+    wire->beginTransmission(i2caddr_);
+    wire->write((uint8_t)0x40);
+    uint16_t bytesOut = 1;
+    while (count--) {
+      if (bytesOut >= WIRE_MAX) {
+        wire->endTransmission();
+        wire->beginTransmission(i2caddr_);
+        wire->write((uint8_t)0x40);
+        bytesOut = 1;
+      }
+      wire->write(*ptr++);
+      bytesOut++;
+    }
+    wire->endTransmission();
+    wire->setClock(restoreClk);
+  }
+
+  void ssd1306_command(uint8_t c) {
+    wire->setClock(wireClk);
+    ssd1306_command1(c);
+    wire->setClock(restoreClk);
+  }
+
+  void invertDisplay(bool i) { (void)i; }
+  void dim(bool dim) { (void)dim; }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    if ((x < 0) || (y < 0) || (x >= width()) || (y >= height())) return;
+    uint8_t& b = buffer[x + (y / 8) * WIDTH];
+    switch (color) {
+      case SSD1306_WHITE: b |= (1 << (y & 7)); break;
+      case SSD1306_BLACK: b &= ~(1 << (y & 7)); break;
+      case SSD1306_INVERSE: b ^= (1 << (y & 7)); break;
+    }
+  }
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+    if ((y < 0) || (y >= HEIGHT)) return;
+    if (x < 0) { w += x; x = 0; }
+    if ((x + w) > WIDTH) w = WIDTH - x;
+    if (w <= 0) return;
+    uint8_t* p = &buffer[(y / 8) * WIDTH + x];
+    uint8_t mask = 1 << (y & 7);
+    switch (color) {
+      case SSD1306_WHITE: while (w--) *p++ |= mask; break;
+      case SSD1306_BLACK: mask = ~mask; while (w--) *p++ &= mask; break;
+      case SSD1306_INVERSE: while (w--) *p++ ^= mask; break;
+    }
+  }
+
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+    if ((x < 0) || (x >= WIDTH)) return;
+    if (y < 0) { h += y; y = 0; }
+    if ((y + h) > HEIGHT) h = HEIGHT - y;
+    for (; h > 0; y++, h--) drawPixel(x, y, color);
+  }
+
+private:
+  void ssd1306_command1(uint8_t c) {
+    wire->beginTransmission(i2caddr_);
+    wire->write((uint8_t)0x00);
+    wire->write(c);
+    wire->endTransmission();
+  }
+  void ssd1306_commandList(const uint8_t* c, uint8_t n) {
+    wire->beginTransmission(i2caddr_);
+    wire->write((uint8_t)0x00);
+    while (n--) wire->write(*c++);
+    wire->endTransmission();
+  }
+
+  TwoWire* wire;
+  uint8_t* buffer = nullptr;
+  uint8_t i2caddr_ = 0x3C;
+  uint32_t wireClk, restoreClk;
+};
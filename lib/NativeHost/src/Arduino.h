@@ -0,0 +1,187 @@
+/*
+ * Host stand-in for the Arduino core (env:native only)
+ *
+ * Just enough of the ESP32 Arduino API for PCMonitor_WifiPortal.cpp to
+ * compile and run on Linux. Time is a mock clock that only moves when the
+ * benchmark (or delay()) advances it, so runs are deterministic.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include <sys/time.h>
+#include <string>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define IRAM_ATTR
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// ========== Mock Clock ==========
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void mockSetMillis(unsigned long ms);
+void mockAdvanceMillis(unsigned long ms);
+void mockSetEpoch(time_t epoch);  // Wall-clock time at mock millis() == 0
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+long random(long max);
+long random(long min, long max);
+
+// ========== String ==========
+class String {
+public:
+  String() {}
+  String(const char* s) : s_(s ? s : "") {}
+  String(const std::string& s) : s_(s) {}
+  String(char c) : s_(1, c) {}
+  String(int v) : s_(std::to_string(v)) {}
+  String(unsigned int v) : s_(std::to_string(v)) {}
+  String(long v) : s_(std::to_string(v)) {}
+  String(unsigned long v) : s_(std::to_string(v)) {}
+  String(float v, unsigned int decimals = 2) { fromFloat(v, decimals); }
+  String(double v, unsigned int decimals = 2) { fromFloat(v, decimals); }
+
+  const char* c_str() const { return s_.c_str(); }
+  unsigned int length() const { return s_.size(); }
+  long toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(s_.c_str(), nullptr); }
+  bool reserve(unsigned int n) { s_.reserve(n); return true; }
+  bool equals(const String& o) const { return s_ == o.s_; }
+  bool operator==(const String& o) const { return s_ == o.s_; }
+  bool operator==(const char* o) const { return s_ == o; }
+  bool operator!=(const String& o) const { return s_ != o.s_; }
+  char operator[](unsigned int i) const { return s_[i]; }
+
+  String& operator+=(const String& o) { s_ += o.s_; return *this; }
+  String& operator+=(const char* o) { s_ += o; return *this; }
+  String& operator+=(char c) { s_ += c; return *this; }
+  String& concat(const String& o) { s_ += o.s_; return *this; }
+
+  friend String operator+(const String& a, const String& b) { return String(a.s_ + b.s_); }
+  friend String operator+(const String& a, const char* b) { return String(a.s_ + b); }
+  friend String operator+(const char* a, const String& b) { return String(a + b.s_); }
+
+private:
+  void fromFloat(double v, unsigned int decimals) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+    s_ = buf;
+  }
+  std::string s_;
+};
+
+// ========== Print ==========
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buf, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buf++);
+    return n;
+  }
+  size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+
+  size_t print(const char* s) { return write(s); }
+  size_t print(const String& s) { return write(s.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v) { return printNumber("%d", v); }
+  size_t print(unsigned int v) { return printNumber("%u", v); }
+  size_t print(long v) { return printNumber("%ld", v); }
+  size_t print(unsigned long v) { return printNumber("%lu", v); }
+  size_t print(double v, int decimals = 2) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+    return write(buf);
+  }
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T& v) { size_t n = print(v); return n + println(); }
+
+private:
+  template <typename T> size_t printNumber(const char* fmt, T v) {
+    char buf[24];
+    snprintf(buf, sizeof(buf), fmt, v);
+    return write(buf);
+  }
+};
+
+// ========== IPAddress ==========
+class IPAddress {
+public:
+  IPAddress() : addr_(0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+      : addr_((uint32_t)a | ((uint32_t)b << 8) | ((uint32_t)c << 16) | ((uint32_t)d << 24)) {}
+  IPAddress(uint32_t addr) : addr_(addr) {}
+  operator uint32_t() const { return addr_; }
+  uint8_t operator[](int i) const { return (addr_ >> (i * 8)) & 0xFF; }
+  bool operator==(const IPAddress& o) const { return addr_ == o.addr_; }
+  bool operator!=(const IPAddress& o) const { return addr_ != o.addr_; }
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return String(buf);
+  }
+
+private:
+  uint32_t addr_;
+};
+
+// ========== Serial ==========
+// Output is discarded unless PCMON_NATIVE_SERIAL is set in the environment,
+// so benchmark numbers are not dominated by terminal I/O.
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t c) override;
+  using Print::write;
+};
+extern HardwareSerial Serial;
+
+// ========== ESP ==========
+class EspClass {
+public:
+  void restart();
+  uint32_t getCycleCount();
+  uint32_t getFreeHeap() { return 200 * 1024; }
+  uint32_t getMinFreeHeap() { return 180 * 1024; }
+  uint32_t getMaxAllocHeap() { return 100 * 1024; }
+  uint32_t getCpuFreqMHz() { return 1000; }  // getCycleCount() ticks in ns
+};
+extern EspClass ESP;
+
+// ========== Time ==========
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char* server1,
+                const char* server2 = nullptr, const char* server3 = nullptr);
+bool getLocalTime(struct tm* info, uint32_t ms = 5000);
+
+// Wall-clock reads in the firmware go through the mock clock as well
+time_t mockTime(time_t* out);
+int mockGettimeofday(struct timeval* tv, void* tz);
+#define time(out) mockTime(out)
+#define gettimeofday(tv, tz) mockGettimeofday(tv, tz)
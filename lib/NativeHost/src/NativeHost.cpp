@@ -0,0 +1,91 @@
+/*
+ * Host stand-in implementation: mock clock, Serial, ESP and driver globals
+ * (env:native only)
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <WiFi.h>
+#include <Preferences.h>
+#include <stdarg.h>
+#include <chrono>
+#include <stdexcept>
+
+#undef time
+#undef gettimeofday
+
+HardwareSerial Serial;
+EspClass ESP;
+TwoWire Wire;
+WiFiClass WiFi;
+unsigned long Preferences::writes = 0;
+
+// ========== Mock Clock ==========
+static uint64_t mock_us = 0;
+static time_t mock_epoch = 1700000000;  // 2023-11-14 22:13:20 UTC
+static long mock_tz_offset = 0;
+
+unsigned long millis() { return (unsigned long)(mock_us / 1000); }
+unsigned long micros() { return (unsigned long)mock_us; }
+void delay(unsigned long ms) { mock_us += (uint64_t)ms * 1000; }
+void delayMicroseconds(unsigned int us) { mock_us += us; }
+void yield() {}
+
+void mockSetMillis(unsigned long ms) { mock_us = (uint64_t)ms * 1000; }
+void mockAdvanceMillis(unsigned long ms) { mock_us += (uint64_t)ms * 1000; }
+void mockSetEpoch(time_t epoch) { mock_epoch = epoch; }
+
+time_t mockTime(time_t* out) {
+  time_t t = mock_epoch + (time_t)(mock_us / 1000000);
+  if (out) *out = t;
+  return t;
+}
+
+int mockGettimeofday(struct timeval* tv, void* tz) {
+  (void)tz;
+  tv->tv_sec = mock_epoch + (time_t)(mock_us / 1000000);
+  tv->tv_usec = (suseconds_t)(mock_us % 1000000);
+  return 0;
+}
+
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char* server1,
+                const char* server2, const char* server3) {
+  (void)server1; (void)server2; (void)server3;
+  mock_tz_offset = gmtOffset_sec + daylightOffset_sec;
+}
+
+bool getLocalTime(struct tm* info, uint32_t ms) {
+  (void)ms;
+  time_t t = mockTime(nullptr) + mock_tz_offset;
+  gmtime_r(&t, info);
+  return true;
+}
+
+long random(long max) { return max > 0 ? ::random() % max : 0; }
+long random(long min, long max) { return max > min ? min + ::random() % (max - min) : min; }
+
+// ========== Serial / Print ==========
+size_t Print::printf(const char* fmt, ...) {
+  char buf[256];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  if (n < 0) return 0;
+  return write((const uint8_t*)buf, (size_t)n < sizeof(buf) ? (size_t)n : sizeof(buf) - 1);
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  static const bool enabled = getenv("PCMON_NATIVE_SERIAL") != nullptr;
+  if (enabled) fputc(c, stderr);
+  return 1;
+}
+
+// ========== ESP ==========
+void EspClass::restart() { throw std::runtime_error("ESP.restart()"); }
+
+uint32_t EspClass::getCycleCount() {
+  // Nanoseconds of real time stand in for CPU cycles on the host
+  using namespace std::chrono;
+  return (uint32_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
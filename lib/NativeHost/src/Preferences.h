@@ -0,0 +1,86 @@
+/*
+ * Host stand-in for the ESP32 Preferences (NVS) library (env:native only)
+ *
+ * Backed by an in-memory map that lives for the duration of the process.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+class Preferences {
+public:
+  bool begin(const char* name, bool readOnly = false) {
+    ns_ = name;
+    readOnly_ = readOnly;
+    return true;
+  }
+  void end() { ns_.clear(); }
+  bool clear() { store()[ns_].clear(); return true; }
+  bool remove(const char* key) { return store()[ns_].erase(key) > 0; }
+  bool isKey(const char* key) { return store()[ns_].count(key) > 0; }
+
+  size_t putInt(const char* key, int32_t v) { return putRaw(key, &v, sizeof(v)); }
+  size_t putUInt(const char* key, uint32_t v) { return putRaw(key, &v, sizeof(v)); }
+  size_t putBool(const char* key, bool v) { uint8_t b = v; return putRaw(key, &b, 1); }
+  size_t putString(const char* key, const char* v) { return putRaw(key, v, strlen(v) + 1); }
+  size_t putString(const char* key, const String& v) { return putString(key, v.c_str()); }
+  size_t putBytes(const char* key, const void* v, size_t len) { return putRaw(key, v, len); }
+
+  int32_t getInt(const char* key, int32_t def = 0) { return getRaw(key, def); }
+  uint32_t getUInt(const char* key, uint32_t def = 0) { return getRaw(key, def); }
+  bool getBool(const char* key, bool def = false) { return getRaw<uint8_t>(key, def) != 0; }
+  String getString(const char* key, const String& def = String()) {
+    auto& ns = store()[ns_];
+    auto it = ns.find(key);
+    return it == ns.end() ? def : String((const char*)it->second.data());
+  }
+  size_t getString(const char* key, char* out, size_t maxLen) {
+    auto& ns = store()[ns_];
+    auto it = ns.find(key);
+    if (it == ns.end() || it->second.size() > maxLen) return 0;
+    memcpy(out, it->second.data(), it->second.size());
+    return it->second.size();
+  }
+  size_t getBytesLength(const char* key) {
+    auto& ns = store()[ns_];
+    auto it = ns.find(key);
+    return it == ns.end() ? 0 : it->second.size();
+  }
+  size_t getBytes(const char* key, void* out, size_t maxLen) {
+    auto& ns = store()[ns_];
+    auto it = ns.find(key);
+    if (it == ns.end() || it->second.size() > maxLen) return 0;
+    memcpy(out, it->second.data(), it->second.size());
+    return it->second.size();
+  }
+
+  // Number of put*() calls that reached the store, for flash-wear checks
+  static unsigned long writes;
+
+private:
+  typedef std::map<std::string, std::map<std::string, std::vector<uint8_t>>> Store;
+  static Store& store() { static Store s; return s; }
+
+  size_t putRaw(const char* key, const void* v, size_t len) {
+    if (readOnly_) return 0;
+    const uint8_t* p = (const uint8_t*)v;
+    store()[ns_][key].assign(p, p + len);
+    writes++;
+    return len;
+  }
+  template <typename T> T getRaw(const char* key, T def) {
+    auto& ns = store()[ns_];
+    auto it = ns.find(key);
+    if (it == ns.end() || it->second.size() != sizeof(T)) return def;
+    T v;
+    memcpy(&v, it->second.data(), sizeof(T));
+    return v;
+  }
+
+  std::string ns_;
+  bool readOnly_ = false;
+};
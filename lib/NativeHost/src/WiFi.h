@@ -0,0 +1,61 @@
+/*
+ * Host stand-in for the ESP32 WiFi library (env:native only)
+ *
+ * Reports a permanently connected station; tests can flip mockStatus to
+ * exercise the disconnect path, and set mockApDown to make joins fail.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <WiFiServer.h>
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_SCAN_COMPLETED = 2,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+class WiFiClass {
+public:
+  wl_status_t status() { return mockStatus; }
+  IPAddress localIP() { return mockIP; }
+  IPAddress gatewayIP() { return IPAddress(192, 168, 0, 1); }
+  IPAddress subnetMask() { return IPAddress(255, 255, 255, 0); }
+  IPAddress dnsIP(uint8_t = 0) { return IPAddress(192, 168, 0, 1); }
+  String SSID() { return String("mock-ssid"); }
+  String psk() { return String("mock-psk"); }
+  int32_t channel() { return 6; }
+  uint8_t* BSSID() { return mockBSSID; }
+  int8_t RSSI() { return -50; }
+  bool mode(wifi_mode_t) { return true; }
+  bool setAutoReconnect(bool) { return true; }
+  bool setSleep(bool) { return true; }
+  void persistent(bool) {}
+  bool config(IPAddress, IPAddress, IPAddress, IPAddress = IPAddress(), IPAddress = IPAddress()) {
+    return true;
+  }
+  wl_status_t begin() { return join(); }
+  wl_status_t begin(const char*, const char* = nullptr, int32_t = 0, const uint8_t* = nullptr,
+                    bool = true) {
+    return join();
+  }
+  bool reconnect() { return join() == WL_CONNECTED; }
+  bool disconnect(bool = false, bool = false) { mockStatus = WL_DISCONNECTED; return true; }
+
+  wl_status_t join() { return mockStatus = mockApDown ? WL_NO_SSID_AVAIL : WL_CONNECTED; }
+
+  wl_status_t mockStatus = WL_CONNECTED;
+  bool mockApDown = false;
+  IPAddress mockIP = IPAddress(192, 168, 0, 19);
+  uint8_t mockBSSID[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,53 @@
+/*
+ * Host stand-in for the ESP32 WiFiClient (env:native only)
+ *
+ * A client is a handle on an in-memory MockSocket. The test side writes the
+ * request into `in` and reads the server's reply from `out`; `write_budget`
+ * caps what one write() accepts, to play a slow client with a full window.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <memory>
+#include <string>
+
+struct MockSocket {
+  std::string in;            // Client -> server, not yet read
+  std::string out;           // Server -> client
+  size_t write_budget = (size_t)-1;
+  bool peer_closed = false;  // Client hung up
+  bool closed = false;       // Server called stop()
+};
+
+class WiFiClient {
+public:
+  WiFiClient() {}
+  explicit WiFiClient(std::shared_ptr<MockSocket> socket) : s_(socket) {}
+
+  uint8_t connected() { return s_ && !s_->closed && (!s_->peer_closed || !s_->in.empty()); }
+  int available() { return s_ ? (int)s_->in.size() : 0; }
+  int read(uint8_t* buf, size_t len) {
+    if (!s_) return -1;
+    size_t n = std::min(len, s_->in.size());
+    memcpy(buf, s_->in.data(), n);
+    s_->in.erase(0, n);
+    return (int)n;
+  }
+  size_t write(const uint8_t* buf, size_t len) {
+    if (!s_ || s_->closed || s_->peer_closed) return 0;
+    size_t n = std::min(len, s_->write_budget);
+    s_->out.append((const char*)buf, n);
+    return n;
+  }
+  void stop() {
+    if (s_) s_->closed = true;
+    s_.reset();
+  }
+  int setNoDelay(bool) { return 0; }
+  IPAddress remoteIP() { return IPAddress(192, 168, 0, 10); }
+  explicit operator bool() { return connected(); }
+
+private:
+  std::shared_ptr<MockSocket> s_;
+};
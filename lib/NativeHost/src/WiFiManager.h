@@ -0,0 +1,28 @@
+/*
+ * Host stand-in for tzapu WiFiManager (env:native only)
+ *
+ * autoConnect() succeeds immediately; the captive portal never opens.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+class WiFiManager {
+public:
+  void setConfigPortalTimeout(unsigned long seconds) { (void)seconds; }
+  void setConnectTimeout(unsigned long seconds) { (void)seconds; }
+  void setAPCallback(void (*fn)(WiFiManager*)) { apCallback_ = fn; }
+  void setSaveConfigCallback(void (*fn)()) { saveCallback_ = fn; }
+  bool autoConnect(const char* apName, const char* apPassword = nullptr) {
+    (void)apName; (void)apPassword;
+    WiFi.begin();
+    return true;
+  }
+  void resetSettings() {}
+
+private:
+  void (*apCallback_)(WiFiManager*) = nullptr;
+  void (*saveCallback_)() = nullptr;
+};
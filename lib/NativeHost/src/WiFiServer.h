@@ -0,0 +1,49 @@
+/*
+ * Host stand-in for the ESP32 WiFiServer (env:native only)
+ *
+ * WiFiServer::mockConnect(port, request) queues an incoming connection for
+ * whichever server listens on `port` and returns its socket, so a benchmark
+ * can drive any number of clients without the network.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <deque>
+#include <map>
+
+class WiFiServer {
+public:
+  explicit WiFiServer(uint16_t port = 80, uint8_t max_clients = 4) : port_(port) {
+    (void)max_clients;
+  }
+  void begin() {}
+  void end() {}
+  void setNoDelay(bool) {}
+
+  bool hasClient() { return !pending()[port_].empty(); }
+  WiFiClient accept() {
+    auto& queue = pending()[port_];
+    if (queue.empty()) return WiFiClient();
+    WiFiClient client(queue.front());
+    queue.pop_front();
+    return client;
+  }
+  WiFiClient available() { return accept(); }
+
+  static std::shared_ptr<MockSocket> mockConnect(uint16_t port, const std::string& request = "") {
+    auto socket = std::make_shared<MockSocket>();
+    socket->in = request;
+    pending()[port].push_back(socket);
+    return socket;
+  }
+
+private:
+  typedef std::map<uint16_t, std::deque<std::shared_ptr<MockSocket>>> Pending;
+  static Pending& pending() {
+    static Pending queues;
+    return queues;
+  }
+  uint16_t port_;
+};
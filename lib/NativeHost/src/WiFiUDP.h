@@ -0,0 +1,77 @@
+/*
+ * Host stand-in for WiFiUDP (env:native only)
+ *
+ * Datagrams are queued with mockInject() and handed out by parsePacket()
+ * in FIFO order, like the lwIP receive queue on the device.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <deque>
+#include <vector>
+
+class WiFiUDP {
+public:
+  uint8_t begin(uint16_t port) { port_ = port; return 1; }
+  void stop() {}
+
+  int parsePacket() {
+    if (queue_.empty()) {
+      current_.data.clear();
+      pos_ = 0;
+      return 0;
+    }
+    current_ = queue_.front();
+    queue_.pop_front();
+    pos_ = 0;
+    return (int)current_.data.size();
+  }
+  int available() { return (int)(current_.data.size() - pos_); }
+  int read(uint8_t* buf, size_t len) {
+    size_t n = current_.data.size() - pos_;
+    if (n > len) n = len;
+    memcpy(buf, current_.data.data() + pos_, n);
+    pos_ += n;
+    return (int)n;
+  }
+  int read(char* buf, size_t len) { return read((uint8_t*)buf, len); }
+  void flush() { pos_ = current_.data.size(); }
+  IPAddress remoteIP() { return current_.ip; }
+  uint16_t remotePort() { return current_.port; }
+
+  int beginPacket(IPAddress ip, uint16_t port) { sentIp = ip; sentPort = port; sent_.clear(); return 1; }
+  size_t write(const uint8_t* buf, size_t len) {
+    for (size_t i = 0; i < len; i++) sent_.push_back(buf[i]);
+    return len;
+  }
+  size_t write(uint8_t b) { sent_.push_back(b); return 1; }
+  int endPacket() { packetsSent++; return 1; }
+
+  void mockInject(const void* data, size_t len, IPAddress ip = IPAddress(192, 168, 0, 10),
+                  uint16_t port = 50000) {
+    Datagram d;
+    d.data.assign((const uint8_t*)data, (const uint8_t*)data + len);
+    d.ip = ip;
+    d.port = port;
+    queue_.push_back(d);
+  }
+  size_t mockQueued() const { return queue_.size(); }
+  const std::vector<uint8_t>& mockSent() const { return sent_; }  // Last packet sent
+
+  unsigned long packetsSent = 0;
+  IPAddress sentIp;
+  uint16_t sentPort = 0;
+
+private:
+  struct Datagram {
+    std::vector<uint8_t> data;
+    IPAddress ip;
+    uint16_t port = 0;
+  };
+  std::deque<Datagram> queue_;
+  Datagram current_;
+  size_t pos_ = 0;
+  std::vector<uint8_t> sent_;
+  uint16_t port_ = 0;
+};
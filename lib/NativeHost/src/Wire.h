@@ -0,0 +1,56 @@
+/*
+ * Host stand-in for the Arduino Wire (I2C) library (env:native only)
+ *
+ * Transfers go nowhere; the bus only counts transactions and bytes so the
+ * display flush path can be measured without a panel attached. With
+ * mockTimed set, each transaction also advances the mock clock by its
+ * time on the bus (9 clocks per byte).
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#ifndef I2C_BUFFER_LENGTH
+#define I2C_BUFFER_LENGTH 128
+#endif
+
+class TwoWire {
+public:
+  bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) {
+    (void)sda; (void)scl;
+    if (frequency) clock = frequency;
+    return true;
+  }
+  bool setClock(uint32_t frequency) { clock = frequency; return true; }
+  uint32_t getClock() { return clock; }
+
+  void beginTransmission(uint8_t address) { (void)address; pending = 0; transactions++; }
+  size_t write(uint8_t data) {
+    (void)data;
+    if (pending >= I2C_BUFFER_LENGTH) return 0;
+    pending++;
+    return 1;
+  }
+  size_t write(const uint8_t* data, size_t len) {
+    size_t n = 0;
+    while (len--) n += write(*data++);
+    return n;
+  }
+  uint8_t endTransmission(bool sendStop = true) {
+    (void)sendStop;
+    bytesWritten += pending + 1;  // + address byte
+    if (mockTimed) delayMicroseconds((unsigned)((pending + 1) * 9ULL * 1000000 / clock));
+    pending = 0;
+    return 0;
+  }
+
+  // Counters for benchmarks
+  uint32_t clock = 100000;
+  uint32_t pending = 0;
+  uint64_t transactions = 0;
+  uint64_t bytesWritten = 0;
+  bool mockTimed = false;
+};
+
+extern TwoWire Wire;
@@ -1,13 +1,20 @@
 #!/usr/bin/env python3
 """
 PC Stats Monitor для Arch Linux (Ryzen + NVIDIA)
+
+Сенсоры и /proc открываются один раз и перечитываются через pread, без
+psutil и без fork на каждый пакет. GPU и диск опрашиваются в фоне реже,
+пакет берёт их последние значения. --profile показывает, сколько CPU
+тратит сам отправитель.
 """
 
-import psutil
 import socket
 import time
 import json
+import struct
+import argparse
 import subprocess
+import threading
 from datetime import datetime
 import os
 import glob
@@ -15,11 +22,54 @@ import glob
 ESP32_IP = "192.168.0.19"
 UDP_PORT = 4210
 BROADCAST_INTERVAL = 3
+DELTA_INTERVAL = 0.5  # с, период по умолчанию с --delta
+KEYFRAME_INTERVAL = 10  # с, полный пакет с --delta не реже этого
+GPU_INTERVAL = 5     # с, температура GPU (фон)
+DISK_INTERVAL = 30   # с, заполненность диска (фон)
+DISK_PATH = "/"
+PROFILE_EVERY = 20   # пакетов на одну строку --profile
+
+# Компактный бинарный формат (см. include/StatsProtocol.h), ~24 байта вместо ~250
+PACKET_MAGIC = 0x4D50
+PACKET_VERSION = 1
+HEADER_FORMAT = struct.Struct("<HBBHH")
+FLAG_HOST_ID = 0x01
+FLAG_SEND_TIME = 0x02
+FLAG_DELTA = 0x04
+FLAG_CORES = 0x08
+MAX_CORES = 64
+CORE_DEADBAND = 4  # 2 %, загрузка ядра в пакете шагами по 0.5 %
+KEYFRAME_REQUEST_MAGIC = 0x4B50
+
+FIELD_CPU_PERCENT = 1 << 0
+FIELD_RAM_PERCENT = 1 << 1
+FIELD_RAM_USED = 1 << 2
+FIELD_RAM_TOTAL = 1 << 3
+FIELD_DISK_PERCENT = 1 << 4
+FIELD_CPU_TEMP = 1 << 5
+FIELD_GPU_TEMP = 1 << 6
+FIELD_FAN_SPEED = 1 << 7
+FIELD_TIMESTAMP = 1 << 8
+FIELD_ALL = (1 << 9) - 1
+
+# Мёртвая зона дельты в единицах пакета: поле уходит, только если ушло от
+# последнего отправленного значения хотя бы на столько
+DEADBAND = {
+    FIELD_CPU_PERCENT: 10,   # 1 %
+    FIELD_RAM_PERCENT: 5,    # 0.5 %
+    FIELD_RAM_USED: 1,       # 0.1 ГБ
+    FIELD_RAM_TOTAL: 1,
+    FIELD_DISK_PERCENT: 5,   # 0.5 %
+    FIELD_CPU_TEMP: 1,       # °C
+    FIELD_GPU_TEMP: 1,
+    FIELD_FAN_SPEED: 50,     # об/мин
+    FIELD_TIMESTAMP: 1,      # каждая новая минута
+}
 
 sensor_paths = {
     "cpu_temp": None,
     "fan": None,
-    "gpu_temp": None
+    "gpu_temp": None  # amdgpu через hwmon; иначе nvidia-smi
 }
 
 def detect_hwmon_sensors():
@@ -50,6 +100,13 @@ def detect_hwmon_sensors():
                         print(f"✓ CPU temp: {temp_file}")
                         break
 
+            # AMD GPU отдаёт температуру через hwmon, nvidia-smi не нужен
+            if name == "amdgpu" and not sensor_paths["gpu_temp"]:
+                temp_file = os.path.join(path, "temp1_input")
+                if os.path.isfile(temp_file):
+                    sensor_paths["gpu_temp"] = temp_file
+                    print(f"✓ GPU temp: {temp_file}")
+
             # Вентиляторы (обычно в it87, nct6775 и т.д.)
             if not sensor_paths["fan"]:
                 fan_files = glob.glob(os.path.join(path, "fan*_input"))
@@ -60,69 +117,383 @@ def detect_hwmon_sensors():
     except Exception as e:
         print(f"Ошибка: {e}")
 
-def read_number(path):
-    try:
-        with open(path, "r") as f:
-            return int(f.read().strip())
-    except:
+class PreadFile:
+    """Файл sysfs/procfs: открыт один раз, каждый раз читается заново через pread"""
+
+    def __init__(self, path, size=64):
+        self.path = path
+        self.size = size
+        self.fd = None
+
+    def read(self):
+        try:
+            if self.fd is None:
+                self.fd = os.open(self.path, os.O_RDONLY)
+            return os.pread(self.fd, self.size, 0)
+        except OSError:
+            # Устройство пропало (например, hwmon перенумеровался): откроем заново
+            self.close()
+            return None
+
+    def read_int(self):
+        data = self.read()
+        try:
+            return int(data) if data else None
+        except ValueError:
+            return None
+
+    def close(self):
+        if self.fd is not None:
+            try:
+                os.close(self.fd)
+            except OSError:
+                pass
+            self.fd = None
+
+
+def cpu_times(line):
+    """(idle, total) из строки cpu/cpuN файла /proc/stat"""
+    fields = [int(x) for x in line.split()[1:9]]
+    return fields[3] + fields[4], sum(fields)  # idle + iowait; guest уже входит в user/nice
+
+
+def cpu_load(now, last):
+    if last is None or now[1] == last[1]:
         return None
+    return 100.0 * (1 - (now[0] - last[0]) / (now[1] - last[1]))
+
+
+class CpuLoad:
+    """Загрузка CPU по /proc/stat между двумя вызовами; с cores=True ещё и по ядрам"""
+
+    def __init__(self, cores=False):
+        # Строки cpuN идут сразу за общей, ~100 байт на ядро
+        self.stat = PreadFile("/proc/stat", 8192 if cores else 256)
+        self.cores = cores
+        self.last = None
+        self.last_cores = []
+        self.core_loads = None
+
+    def sample(self):
+        data = self.stat.read()
+        if not data:
+            return None
+        lines = data.split(b"\n", MAX_CORES + 1 if self.cores else 1)
+        now = cpu_times(lines[0])
+        last, self.last = self.last, now
+        if self.cores:
+            times = [cpu_times(line) for line in lines[1:MAX_CORES + 1] if line.startswith(b"cpu")]
+            loads = [cpu_load(t, l) for t, l in zip(times, self.last_cores)]
+            self.core_loads = loads if loads and None not in loads else None
+            self.last_cores = times
+        load = cpu_load(now, last)
+        return None if load is None else round(load, 1)
+
+
+class MemInfo:
+    """Память из /proc/meminfo, считается так же, как psutil.virtual_memory()"""
+
+    KEYS = (b"MemTotal", b"MemFree", b"MemAvailable", b"Buffers", b"Cached", b"SReclaimable")
+
+    def __init__(self):
+        self.file = PreadFile("/proc/meminfo", 4096)
+
+    def sample(self):
+        data = self.file.read()
+        if not data:
+            return None, None, None
+        kb = {}
+        for line in data.split(b"\n"):
+            name, _, rest = line.partition(b":")
+            if name in self.KEYS:
+                kb[name] = int(rest.split()[0])
+        total = kb.get(b"MemTotal", 0)
+        if not total:
+            return None, None, None
+        free = kb.get(b"MemFree", 0)
+        cached = kb.get(b"Cached", 0) + kb.get(b"SReclaimable", 0)
+        available = kb.get(b"MemAvailable", free + kb.get(b"Buffers", 0) + cached)
+        used = total - free - kb.get(b"Buffers", 0) - cached
+        if used < 0:
+            used = total - free
+        gb = 1024 ** 2  # kB
+        return (round(100.0 * (total - available) / total, 1),
+                round(used / gb, 1), round(total / gb, 1))
+
 
-def get_gpu_temp():
-    """NVIDIA RTX 3080 Ti"""
+def disk_percent(path):
     try:
-        output = subprocess.check_output(
-            ["nvidia-smi", "--query-gpu=temperature.gpu", "--format=csv,noheader,nounits"],
-            stderr=subprocess.DEVNULL,
-            timeout=2
-        )
-        return int(output.decode().strip())
-    except:
+        st = os.statvfs(path)
+    except OSError:
         return None
+    used = (st.f_blocks - st.f_bfree) * st.f_frsize
+    total = used + st.f_bavail * st.f_frsize
+    return round(100.0 * used / total, 1) if total else None
 
-def get_sensor_values():
-    cpu_temp = None
-    fan = None
-    gpu_temp = None
 
-    if sensor_paths["cpu_temp"]:
-        t = read_number(sensor_paths["cpu_temp"])
-        cpu_temp = t // 1000 if t else None
+class SlowSources:
+    """Дорогие источники в фоне со своим периодом; пакет берёт последние значения"""
 
-    if sensor_paths["fan"]:
-        fan = read_number(sensor_paths["fan"])
+    def __init__(self, gpu_path):
+        self.gpu_temp = None
+        self.disk_percent = None
+        self.gpu_file = PreadFile(gpu_path) if gpu_path else None
 
-    gpu_temp = get_gpu_temp()
+    def start(self):
+        threading.Thread(target=self.poll, daemon=True).start()
+        if self.gpu_file is None:
+            threading.Thread(target=self.watch_nvidia, daemon=True).start()
 
-    return fan, cpu_temp, gpu_temp
+    def poll(self):
+        next_disk = next_gpu = 0.0
+        while True:
+            now = time.monotonic()
+            if now >= next_disk:
+                self.disk_percent = disk_percent(DISK_PATH)
+                next_disk = now + DISK_INTERVAL
+            if self.gpu_file and now >= next_gpu:
+                t = self.gpu_file.read_int()
+                self.gpu_temp = t // 1000 if t is not None else None
+                next_gpu = now + GPU_INTERVAL
+            due = min(next_disk, next_gpu) if self.gpu_file else next_disk
+            time.sleep(max(0.1, due - time.monotonic()))
+
+    def watch_nvidia(self):
+        # Один долгоживущий nvidia-smi с -l вместо запуска на каждый пакет
+        try:
+            proc = subprocess.Popen(
+                ["nvidia-smi", "--id=0", "--query-gpu=temperature.gpu",
+                 "--format=csv,noheader,nounits", "-l", str(GPU_INTERVAL)],
+                stdout=subprocess.PIPE, stderr=subprocess.DEVNULL
+            )
+        except OSError:
+            return
+        for line in proc.stdout:
+            try:
+                self.gpu_temp = int(line)
+            except ValueError:
+                self.gpu_temp = None
+        self.gpu_temp = None  # nvidia-smi завершился
+
+
+class Sampler:
+    """Всё, что нужно для одного пакета; файлы открыты на всё время работы"""
+
+    def __init__(self, cores=False):
+        self.cpu = CpuLoad(cores)
+        self.mem = MemInfo()
+        self.cpu_temp = PreadFile(sensor_paths["cpu_temp"]) if sensor_paths["cpu_temp"] else None
+        self.fan = PreadFile(sensor_paths["fan"]) if sensor_paths["fan"] else None
+        self.slow = SlowSources(sensor_paths["gpu_temp"])
+        self.slow.start()
+        self.cpu.sample()  # Точка отсчёта для первой загрузки CPU
+
+    def sample(self):
+        t = self.cpu_temp.read_int() if self.cpu_temp else None
+        ram_percent, ram_used, ram_total = self.mem.sample()
+        stats = {
+            'timestamp': datetime.now().strftime('%H:%M'),
+            'cpu_percent': self.cpu.sample(),
+            'ram_percent': ram_percent,
+            'ram_used_gb': ram_used,
+            'ram_total_gb': ram_total,
+            'disk_percent': self.slow.disk_percent,
+            'cpu_temp': t // 1000 if t is not None else None,
+            'gpu_temp': self.slow.gpu_temp,
+            'fan_speed': self.fan.read_int() if self.fan else None,
+            'status': 'online'
+        }
+        if self.cpu.core_loads:
+            stats['cpu_cores'] = [round(x) for x in self.cpu.core_loads]
+        return stats
+
+
+class Profiler:
+    """--profile: время CPU самого отправителя на пакет"""
+
+    def __init__(self):
+        self.reset()
+
+    def reset(self):
+        self.count = 0
+        self.sample_cpu = 0.0
+        self.send_cpu = 0.0
+        self.process_cpu = time.process_time()
+        self.wall = time.monotonic()
+
+    def add(self, sample_cpu, send_cpu):
+        self.count += 1
+        self.sample_cpu += sample_cpu
+        self.send_cpu += send_cpu
+        if self.count < PROFILE_EVERY:
+            return
+        process = time.process_time() - self.process_cpu  # Все потоки, включая фон
+        wall = time.monotonic() - self.wall
+        us = 1e6 / self.count
+        print(f"[profile] {self.count} пакетов: сбор {self.sample_cpu * us:.0f} мкс, "
+              f"отправка {self.send_cpu * us:.0f} мкс CPU на пакет; весь процесс "
+              f"{process * us:.0f} мкс на пакет, {100.0 * process / wall:.3f}% CPU")
+        self.reset()
+
+def monotonic_ms():
+    # Время отправки для замера задержки на дисплее (часы не синхронизируются)
+    return int(time.monotonic() * 1000) & 0xFFFFFFFF
 
-def get_system_stats():
-    fan_speed, cpu_temp, gpu_temp = get_sensor_values()
+def wire_fields(stats):
+    """Поля пакета в порядке протокола: (бит, формат, значение или None)"""
+    def fixed10(key):
+        v = stats.get(key)
+        return None if v is None else max(0, min(65535, int(round(v * 10))))
 
-    stats = {
-        'timestamp': datetime.now().strftime('%H:%M'),
-        'cpu_percent': round(psutil.cpu_percent(interval=0), 1),
-        'ram_percent': round(psutil.virtual_memory().percent, 1),
-        'ram_used_gb': round(psutil.virtual_memory().used / (1024**3), 1),
-        'ram_total_gb': round(psutil.virtual_memory().total / (1024**3), 1),
-        'disk_percent': round(psutil.disk_usage('/').percent, 1),
-        'cpu_temp': cpu_temp,
-        'gpu_temp': gpu_temp,
-        'fan_speed': fan_speed,
-        'status': 'online'
-    }
+    def clamp(key, lo, hi):
+        v = stats.get(key)
+        return None if v is None else max(lo, min(hi, int(v)))
 
-    return stats
+    now = datetime.now()
+    return (
+        (FIELD_CPU_PERCENT, "H", fixed10('cpu_percent')),
+        (FIELD_RAM_PERCENT, "H", fixed10('ram_percent')),
+        (FIELD_RAM_USED, "H", fixed10('ram_used_gb')),
+        (FIELD_RAM_TOTAL, "H", fixed10('ram_total_gb')),
+        (FIELD_DISK_PERCENT, "H", fixed10('disk_percent')),
+        (FIELD_CPU_TEMP, "b", clamp('cpu_temp', -128, 127)),
+        (FIELD_GPU_TEMP, "b", clamp('gpu_temp', -128, 127)),
+        (FIELD_FAN_SPEED, "H", clamp('fan_speed', 0, 65535)),
+        (FIELD_TIMESTAMP, "BB", now.hour * 60 + now.minute),
+    )
 
-def send_stats(sock, stats):
+def wire_cores(stats):
+    """Загрузка ядер шагами по 0.5 % (0-200) или None"""
+    cores = stats.get('cpu_cores')
+    if not cores:
+        return None
+    return [max(0, min(200, int(round(v * 2)))) for v in cores[:MAX_CORES]]
+
+def pack_packet(fields, seq, host_id, send_ms, delta_mask=None, cores=None):
+    """Ключевой кадр (все поля, отсутствующие нулями) или дельта с полями из delta_mask;
+    cores - блок загрузки по ядрам, в дельте только если он изменился"""
+    flags = FLAG_SEND_TIME | (FLAG_HOST_ID if host_id else 0) | (FLAG_CORES if cores else 0)
+    if delta_mask is None:
+        wire = FIELD_ALL
+        present = sum(bit for bit, _, v in fields if v is not None)
+    else:
+        flags |= FLAG_DELTA
+        wire = present = delta_mask
+    body = b""
+    for bit, fmt, v in fields:
+        if wire & bit:
+            v = v or 0
+            body += struct.pack("<" + fmt, *(divmod(v, 60) if fmt == "BB" else (v,)))
+    packet = HEADER_FORMAT.pack(PACKET_MAGIC, PACKET_VERSION, flags, seq & 0xFFFF, present) + body
+    if host_id:
+        packet += bytes([host_id])
+    packet += struct.pack("<I", send_ms)
+    if cores:
+        packet += bytes([len(cores)]) + bytes(cores)
+    return packet
+
+def encode_binary(stats, seq, host_id=0, send_ms=0):
+    return pack_packet(wire_fields(stats), seq, host_id, send_ms, cores=wire_cores(stats))
+
+
+class DeltaEncoder:
+    """--delta: между ключевыми кадрами только поля, вышедшие за мёртвую зону"""
+
+    def __init__(self):
+        self.sent = None           # Значения полей на дисплее
+        self.sent_cores = None
+        self.keyframe_at = 0.0
+        self.keyframe_wanted = True
+
+    def request_keyframe(self):
+        self.keyframe_wanted = True
+
+    def encode(self, stats, seq, host_id=0, send_ms=0):
+        fields = wire_fields(stats)
+        values = {bit: v for bit, _, v in fields}
+        cores = wire_cores(stats)
+        now = time.monotonic()
+        # Поле появилось или пропало: дельта не умеет передать null
+        presence_changed = self.sent is not None and (
+            any((v is None) != (self.sent[bit] is None) for bit, v in values.items())
+            or (cores is None) != (self.sent_cores is None))
+        if self.keyframe_wanted or presence_changed or now >= self.keyframe_at:
+            self.sent = values
+            self.sent_cores = cores
+            self.keyframe_at = now + KEYFRAME_INTERVAL
+            self.keyframe_wanted = False
+            return pack_packet(fields, seq, host_id, send_ms, cores=cores)
+        mask = 0
+        for bit, v in values.items():
+            if v is not None and abs(v - self.sent[bit]) >= DEADBAND[bit]:
+                mask |= bit
+                self.sent[bit] = v
+        # Блок ядер целиком, если хоть одно ушло за мёртвую зону
+        if cores and (len(cores) != len(self.sent_cores) or any(
+                abs(c - s) >= CORE_DEADBAND for c, s in zip(cores, self.sent_cores))):
+            self.sent_cores = cores
+        else:
+            cores = None
+        return pack_packet(fields, seq, host_id, send_ms, mask, cores)
+
+def keyframe_requested(sock):
+    """Дисплей просил ключевой кадр (после потерянного пакета)?"""
+    asked = False
+    while True:
+        try:
+            data = sock.recv(16, socket.MSG_DONTWAIT)
+        except OSError:  # Пусто, или ICMP от недоступного дисплея
+            return asked
+        if len(data) >= 3 and struct.unpack_from("<HB", data) == (KEYFRAME_REQUEST_MAGIC, PACKET_VERSION):
+            asked = True
+
+def send_stats(sock, stats, binary=False, seq=0, host_id=0, ip=ESP32_IP, quiet=False, delta=None):
     try:
-        msg = json.dumps(stats).encode()
-        sock.sendto(msg, (ESP32_IP, UDP_PORT))
+        send_ms = monotonic_ms()
+        if delta:
+            msg = delta.encode(stats, seq, host_id, send_ms)
+        elif binary:
+            msg = encode_binary(stats, seq, host_id, send_ms)
+        else:
+            stats = dict(stats, seq=seq, send_ms=send_ms)
+            if host_id:
+                stats['host_id'] = host_id
+            msg = json.dumps(stats).encode()
+        sock.sendto(msg, (ip, UDP_PORT))
+        if quiet:
+            return
         print(f"[{stats['timestamp']}] CPU {stats['cpu_percent']}% ({stats['cpu_temp']}°C) | "
               f"GPU {stats['gpu_temp']}°C | RAM {stats['ram_percent']}% | Fan {stats['fan_speed']}")
     except Exception as e:
         print(f"Ошибка отправки: {e}")
 
 def main():
+    parser = argparse.ArgumentParser(description="PC Stats Monitor sender")
+    parser.add_argument("--ip", default=ESP32_IP,
+                        help="адрес дисплея (по умолчанию %(default)s)")
+    parser.add_argument("--binary", action="store_true",
+                        help="компактный бинарный формат вместо JSON (прошивка с поддержкой v1)")
+    parser.add_argument("--host-id", type=int, default=0, choices=range(0, 256), metavar="1-255",
+                        help="номер хоста для дисплея с несколькими ПК (по умолчанию - по IP)")
+    parser.add_argument("--delta", action="store_true",
+                        help=f"бинарный формат, между ключевыми кадрами (раз в {KEYFRAME_INTERVAL} с) "
+                             "только изменившиеся поля; нужна прошивка с поддержкой дельт")
+    parser.add_argument("--cores", action="store_true",
+                        help=f"добавлять загрузку каждого ядра (до {MAX_CORES}) для экрана "
+                             "Per-Core Bars")
+    parser.add_argument("--interval", type=float,
+                        help=f"секунд между пакетами (по умолчанию {BROADCAST_INTERVAL}, "
+                             f"с --delta {DELTA_INTERVAL})")
+    parser.add_argument("--profile", action="store_true",
+                        help=f"каждые {PROFILE_EVERY} пакетов печатать время CPU самого отправителя")
+    parser.add_argument("--count", type=int, default=0,
+                        help="остановиться после стольких пакетов (по умолчанию - без конца)")
+    parser.add_argument("--quiet", action="store_true",
+                        help="не печатать строку на каждый пакет")
+    args = parser.parse_args()
+    if args.interval is None:
+        args.interval = DELTA_INTERVAL if args.delta else BROADCAST_INTERVAL
+
     print("=" * 60)
     print("PC Stats Monitor - Arch Linux (Ryzen + NVIDIA)")
     print("=" * 60)
@@ -134,13 +505,26 @@ def main():
     print("-" * 60)
 
     sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
-    psutil.cpu_percent(interval=1)
+    sampler = Sampler(args.cores)
+    profiler = Profiler() if args.profile else None
+    delta = DeltaEncoder() if args.delta else None
+    time.sleep(1)
+    seq = 0
+    sent = 0
 
     try:
-        while True:
-            stats = get_system_stats()
-            send_stats(sock, stats)
-            time.sleep(BROADCAST_INTERVAL)
+        while not args.count or sent < args.count:
+            t0 = time.thread_time()
+            stats = sampler.sample()
+            t1 = time.thread_time()
+            if delta and keyframe_requested(sock):
+                delta.request_keyframe()
+            send_stats(sock, stats, args.binary, seq, args.host_id, args.ip, args.quiet, delta)
+            if profiler:
+                profiler.add(t1 - t0, time.thread_time() - t1)
+            seq = (seq + 1) & 0xFFFF
+            sent += 1
+            time.sleep(args.interval)
     except KeyboardInterrupt:
         print("\nОстановлено.")
     finally:
@@ -13,6 +13,7 @@ from datetime import datetime
 ESP32_IP = "192.168.0.163"  # Change to your ESP32 IP address
 UDP_PORT = 4210
 BROADCAST_INTERVAL = 3  # Increased to 3 seconds for even less CPU usage
+SEND_CORES = False  # Per-core load for the "Per-Core Bars" stats style (up to 64 cores)
 
 # Sensor identifiers (will be populated at startup)
 sensor_ids = {
@@ -104,11 +105,16 @@ def get_system_stats():
         'fan_speed': fan_speed,  # Can be pump, case fan, CPU fan, etc.
         'status': 'online'
     }
+    if SEND_CORES:
+        stats['cpu_cores'] = [round(x) for x in psutil.cpu_percent(interval=0, percpu=True)[:64]]
     return stats
 
-def send_stats(sock, stats):
+def send_stats(sock, stats, seq=0):
     """Send stats to ESP32 via UDP"""
     try:
+        # Sequence number and send time (monotonic ms) let the display count
+        # lost packets and measure latency
+        stats = dict(stats, seq=seq, send_ms=int(time.monotonic() * 1000) & 0xFFFFFFFF)
         message = json.dumps(stats).encode('utf-8')
         sock.sendto(message, (ESP32_IP, UDP_PORT))
         print(f"[{stats['timestamp']}] CPU {stats['cpu_percent']}% | RAM {stats['ram_percent']}% | Fan {stats['fan_speed'] or 'N/A'} RPM")
@@ -137,11 +143,16 @@ def main():
     
     # Initial CPU reading to warm up psutil
     psutil.cpu_percent(interval=1)
+    if SEND_CORES:
+        psutil.cpu_percent(interval=0, percpu=True)
+    
+    seq = 0
     
     try:
         while True:
             stats = get_system_stats()
-            send_stats(sock, stats)
+            send_stats(sock, stats, seq)
+            seq = (seq + 1) & 0xFFFF
             time.sleep(BROADCAST_INTERVAL)
     except KeyboardInterrupt:
         print("\n\nStopped.")
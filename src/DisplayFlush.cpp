@@ -0,0 +1,143 @@
+/*
+ * DisplayFlush - dirty-page I2C flush for the SSD1306
+ */
+
+#include "DisplayFlush.h"
+
+#ifdef I2C_BUFFER_LENGTH
+#define FLUSH_WIRE_MAX min(256, I2C_BUFFER_LENGTH)
+#else
+#define FLUSH_WIRE_MAX 32
+#endif
+
+DisplayFlush::DisplayFlush(Adafruit_SSD1306& display, TwoWire& wire, uint8_t address,
+                           uint32_t clock)
+    : display(display), wire(wire), address(address), clock(clock) {
+}
+
+void DisplayFlush::invalidate() {
+  shadow_valid = false;
+}
+
+void DisplayFlush::start(unsigned priority, uint32_t stack_size) {
+#ifndef PCMON_NATIVE
+  if (front_ready != nullptr) return;
+  front_ready = xSemaphoreCreateBinary();
+  front_free = xSemaphoreCreateBinary();
+  xSemaphoreGive(front_free);
+  xTaskCreate(taskEntry, "flush", stack_size, this, priority, nullptr);
+#else
+  (void)priority; (void)stack_size;  // Native build flushes inline
+#endif
+}
+
+uint32_t DisplayFlush::flush(uint32_t tag) {
+  const uint8_t* buffer = display.getBuffer();
+
+  if (buffer == nullptr) {
+    return 0;
+  }
+
+#ifndef PCMON_NATIVE
+  if (front_ready != nullptr) {
+    // Swap at the frame boundary: wait until the last frame is on the
+    // panel, then hand this one over and go back to drawing
+    xSemaphoreTake(front_free, portMAX_DELAY);
+    memcpy(front, buffer, sizeof(front));
+    front_tag = tag;
+    xSemaphoreGive(front_ready);
+    return 0;
+  }
+#endif
+
+  return sendFrame(buffer, tag);
+}
+
+#ifndef PCMON_NATIVE
+void DisplayFlush::taskEntry(void* arg) {
+  DisplayFlush* self = static_cast<DisplayFlush*>(arg);
+  for (;;) {
+    xSemaphoreTake(self->front_ready, portMAX_DELAY);
+    self->sendFrame(self->front, self->front_tag);
+    xSemaphoreGive(self->front_free);
+  }
+}
+#endif
+
+uint32_t DisplayFlush::sendFrame(const uint8_t* buffer, uint32_t tag) {
+  uint32_t sent = 0;
+
+  for (uint8_t page = 0; page < PAGES; page++) {
+    const uint8_t* row = buffer + page * WIDTH;
+    uint8_t* shadow_row = shadow + page * WIDTH;
+
+    if (!shadow_valid) {
+      if (sent == 0) wire.setClock(clock);
+      sent += sendWindow(page, 0, WIDTH - 1, row);
+      continue;
+    }
+
+    // Walk the page collecting changed runs, merging runs separated by
+    // fewer than MERGE_GAP unchanged columns into a single window
+    int run_start = -1;
+    int run_end = -1;
+    for (int col = 0; col < WIDTH; col++) {
+      if (row[col] == shadow_row[col]) continue;
+
+      if (run_start >= 0 && col - run_end > MERGE_GAP) {
+        if (sent == 0) wire.setClock(clock);
+        sent += sendWindow(page, run_start, run_end, row + run_start);
+        run_start = -1;
+      }
+      if (run_start < 0) run_start = col;
+      run_end = col;
+    }
+    if (run_start >= 0) {
+      if (sent == 0) wire.setClock(clock);
+      sent += sendWindow(page, run_start, run_end, row + run_start);
+    }
+  }
+
+  memcpy(shadow, buffer, sizeof(shadow));
+  shadow_valid = true;
+
+  unsigned long now = millis();
+  byte_rate.add(now, sent);
+  frame_rate.tick(now);
+  total_bytes += sent;
+  total_flushes++;
+
+  if (tag && sent_hook) sent_hook(tag);
+  return sent;
+}
+
+uint32_t DisplayFlush::sendWindow(uint8_t page, uint8_t col_start, uint8_t col_end,
+                                  const uint8_t* data) {
+  const uint8_t window[] = {
+    SSD1306_COLUMNADDR, col_start, col_end,
+    SSD1306_PAGEADDR, page, page
+  };
+  uint32_t bytes = 0;
+
+  // Address the window: control byte 0x00 = command stream
+  wire.beginTransmission(address);
+  wire.write((uint8_t)0x00);
+  wire.write(window, sizeof(window));
+  wire.endTransmission();
+  bytes += 1 + 1 + sizeof(window);
+
+  // Data: control byte 0x40, then as many bytes as fit in the Wire buffer
+  uint16_t count = col_end - col_start + 1;
+  while (count > 0) {
+    uint16_t chunk = min((int)count, FLUSH_WIRE_MAX - 1);
+    wire.beginTransmission(address);
+    wire.write((uint8_t)0x40);
+    wire.write(data, chunk);
+    wire.endTransmission();
+    bytes += 1 + 1 + chunk;
+    data += chunk;
+    count -= chunk;
+  }
+
+  return bytes;
+}
@@ -0,0 +1,465 @@
+/*
+ * HttpServer - small non-blocking HTTP server for the settings UI
+ */
+
+#include "HttpServer.h"
+#include <strings.h>
+#ifndef PCMON_NATIVE
+#include <errno.h>
+#include <lwip/sockets.h>
+#endif
+
+static const char* statusText(int status) {
+  switch (status) {
+    case 200: return "OK";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 413: return "Payload Too Large";
+    case 503: return "Service Unavailable";
+    default:  return "Internal Server Error";
+  }
+}
+
+static int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// Bytes the socket took right now: 0 if the peer's window is full, -1 if
+// the connection is gone
+static int sendNow(WiFiClient& client, const uint8_t* data, size_t len) {
+#ifdef PCMON_NATIVE
+  if (!client.connected()) return -1;
+  return (int)client.write(data, len);  // The stand-in never blocks
+#else
+  int n = send(client.fd(), data, len, MSG_DONTWAIT);
+  if (n >= 0) return n;
+  return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+#endif
+}
+
+// Accept-Encoding lists gzip, or "*", without q=0; an explicit gzip entry
+// wins over "*"
+static bool acceptsGzip(const char* accept) {
+  if (!accept) return false;
+  bool any = false;
+  const char* p = accept;
+  while (*p) {
+    while (*p == ' ' || *p == ',') p++;
+    const char* token = p;
+    while (*p && *p != ',' && *p != ';' && *p != ' ') p++;
+    size_t len = p - token;
+    bool refused = false;
+    for (; *p && *p != ','; p++) {
+      if ((*p == 'q' || *p == 'Q') && p[1] == '=') refused = strtod(p + 2, nullptr) == 0;
+    }
+    if (len == 4 && strncasecmp(token, "gzip", 4) == 0) return !refused;
+    if (len == 1 && *token == '*') any = !refused;
+  }
+  return any;
+}
+
+// ========== HttpRequest ==========
+
+const char* HttpRequest::header(const char* name) const {
+  size_t name_len = strlen(name);
+  for (const char* line = headers; line < headers_end; line += strlen(line) + 2) {
+    if (strncasecmp(line, name, name_len) == 0 && line[name_len] == ':') {
+      const char* value = line + name_len + 1;
+      while (*value == ' ') value++;
+      return value;
+    }
+  }
+  return nullptr;
+}
+
+// Start of the (still encoded) value of `name` in the query string or the
+// form body, terminated by '&' or '\0'
+const char* HttpRequest::findArg(const char* name) const {
+  size_t name_len = strlen(name);
+  const char* sources[] = {query, body};
+  for (const char* p : sources) {
+    while (*p) {
+      if (strncmp(p, name, name_len) == 0 &&
+          (p[name_len] == '=' || p[name_len] == '&' || p[name_len] == '\0')) {
+        return p[name_len] == '=' ? p + name_len + 1 : p + name_len;
+      }
+      const char* next = strchr(p, '&');
+      if (!next) break;
+      p = next + 1;
+    }
+  }
+  return nullptr;
+}
+
+bool HttpRequest::hasArg(const char* name) const {
+  return findArg(name) != nullptr;
+}
+
+bool HttpRequest::arg(const char* name, char* out, size_t size) const {
+  const char* p = findArg(name);
+  if (!p || size == 0) return false;
+
+  size_t len = 0;
+  for (; *p && *p != '&' && len < size - 1; p++) {
+    char c = *p;
+    if (c == '+') {
+      c = ' ';
+    } else if (c == '%' && hexValue(p[1]) >= 0 && hexValue(p[2]) >= 0) {
+      c = (char)(hexValue(p[1]) * 16 + hexValue(p[2]));
+      p += 2;
+    }
+    out[len++] = c;
+  }
+  out[len] = '\0';
+  return true;
+}
+
+long HttpRequest::argInt(const char* name, long fallback) const {
+  char value[16];
+  if (!arg(name, value, sizeof(value))) return fallback;
+  char* end;
+  long v = strtol(value, &end, 10);
+  return end == value ? fallback : v;
+}
+
+// ========== HttpResponse ==========
+
+void HttpResponse::send(int code, const char* content_type, size_t len) {
+  status = code;
+  type = content_type;
+  body = (const uint8_t*)buf;
+  body_len = len < cap ? len : cap;
+}
+
+void HttpResponse::sendStatic(int code, const char* content_type, const uint8_t* data,
+                              size_t len) {
+  status = code;
+  type = content_type;
+  body = data;
+  body_len = len;
+}
+
+void HttpResponse::stream(int code, const char* content_type, Filler filler) {
+  status = code;
+  type = content_type;
+  fill = filler;
+}
+
+void HttpResponse::header(const char* name, const char* value) {
+  int n = snprintf(extra + extra_len, sizeof(extra) - extra_len, "%s: %s\r\n", name, value);
+  if (n > 0 && extra_len + n < sizeof(extra)) extra_len += n;
+  else extra[extra_len] = '\0';  // Doesn't fit: drop it whole
+}
+
+// ========== HttpServer ==========
+
+HttpServer::HttpServer(uint16_t port) : listener(port, MAX_CONNECTIONS) {
+}
+
+void HttpServer::on(const char* path, HttpVerb verb, Handler handler) {
+  if (route_count >= MAX_ROUTES) return;
+  routes[route_count++] = {path, verb, handler, nullptr, nullptr, 0, nullptr, nullptr, 0, nullptr};
+}
+
+void HttpServer::onStatic(const char* path, const char* type, const uint8_t* gzip, size_t gzip_len,
+                          const char* gzip_etag, const uint8_t* raw, size_t raw_len,
+                          const char* raw_etag) {
+  if (route_count >= MAX_ROUTES) return;
+  routes[route_count++] = {path, VERB_GET, nullptr, type, gzip, gzip_len, gzip_etag,
+                           raw, raw_len, raw_etag};
+}
+
+void HttpServer::begin() {
+  listener.begin();
+  listener.setNoDelay(true);
+}
+
+void HttpServer::end() {
+  for (Connection& c : conns) {
+    if (c.state != CONN_FREE) close(c);
+  }
+  listener.end();
+}
+
+uint8_t HttpServer::openConnections() const {
+  uint8_t n = 0;
+  for (const Connection& c : conns) {
+    if (c.state != CONN_FREE) n++;
+  }
+  return n;
+}
+
+void HttpServer::poll(unsigned long now) {
+  accept(now);
+
+  for (Connection& c : conns) {
+    if (c.state == CONN_READING) read(c, now);
+    if (c.state == CONN_WRITING) write(c, now);
+
+    if (c.state != CONN_FREE && now - c.last_activity > IDLE_TIMEOUT) {
+      total_timeouts++;
+      close(c);
+    }
+  }
+}
+
+void HttpServer::accept(unsigned long now) {
+  static const char BUSY[] =
+    "HTTP/1.1 503 Service Unavailable\r\nRetry-After: 1\r\n"
+    "Content-Length: 0\r\nConnection: close\r\n\r\n";
+
+  for (int n = 0; n < MAX_CONNECTIONS && listener.hasClient(); n++) {
+    Connection* slot = nullptr;
+    for (Connection& c : conns) {
+      if (c.state == CONN_FREE) {
+        slot = &c;
+        break;
+      }
+    }
+
+    WiFiClient client = listener.accept();
+    if (!slot) {
+      // Over the cap: a short answer fits in the socket buffer, no waiting
+      sendNow(client, (const uint8_t*)BUSY, sizeof(BUSY) - 1);
+      client.stop();
+      total_rejected++;
+      continue;
+    }
+
+    slot->client = client;
+    slot->client.setNoDelay(true);
+    slot->state = CONN_READING;
+    slot->last_activity = now;
+    slot->rx_len = 0;
+    slot->header_end = 0;
+    slot->content_length = 0;
+    slot->sent = 0;
+    slot->fill = nullptr;
+  }
+}
+
+void HttpServer::read(Connection& c, unsigned long now) {
+  int avail = c.client.available();
+  if (avail <= 0) {
+    if (!c.client.connected()) close(c);
+    return;
+  }
+
+  size_t room = RX_BUFFER - c.rx_len;
+  if (room == 0) {
+    reject(c, 413);
+    return;
+  }
+  int n = c.client.read((uint8_t*)c.rx + c.rx_len, (size_t)avail < room ? avail : room);
+  if (n <= 0) return;
+  size_t scan_from = c.rx_len > 3 ? c.rx_len - 3 : 0;
+  c.rx_len += n;
+  c.rx[c.rx_len] = '\0';
+  c.last_activity = now;
+
+  if (c.header_end == 0) {
+    char* end = strstr(c.rx + scan_from, "\r\n\r\n");
+    if (!end) {
+      if (c.rx_len == RX_BUFFER) reject(c, 413);
+      return;
+    }
+    if (!parseHead(c, end)) {
+      reject(c, 400);
+      return;
+    }
+    if (c.content_length > RX_BUFFER - c.header_end) {
+      reject(c, 413);
+      return;
+    }
+  }
+
+  if (c.rx_len < c.header_end + c.content_length) return;  // Body still arriving
+
+  c.rx[c.header_end + c.content_length] = '\0';
+  c.req.body = c.rx + c.header_end;
+  total_requests++;
+  dispatch(c);
+}
+
+// Split the request line and headers in place; `end` is the blank line
+bool HttpServer::parseHead(Connection& c, char* end) {
+  HttpRequest& req = c.req;
+  req = HttpRequest();
+  c.header_end = end + 4 - c.rx;
+
+  // Every "\r\n" becomes "\0\0", so each line is a C string
+  end[2] = '\0';
+  for (char* p = c.rx; p < end + 2; p++) {
+    if (p[0] == '\r' && p[1] == '\n') p[0] = p[1] = '\0';
+  }
+
+  // "GET /path?query HTTP/1.1"
+  char* method = c.rx;
+  char* target = strchr(method, ' ');
+  if (!target) return false;
+  *target++ = '\0';
+  char* version = strchr(target, ' ');
+  if (!version) return false;
+  *version = '\0';
+
+  if (strcmp(method, "GET") == 0) req.verb = VERB_GET;
+  else if (strcmp(method, "HEAD") == 0) req.verb = VERB_HEAD;
+  else if (strcmp(method, "POST") == 0) req.verb = VERB_POST;
+  else req.verb = VERB_OTHER;
+
+  char* query = strchr(target, '?');
+  if (query) {
+    *query++ = '\0';
+    req.query = query;
+  }
+  req.path = target;
+
+  req.headers = version + strlen(version + 1) + 3;  // Past the request line's "\0\0"
+  req.headers_end = end + 2;
+  if (req.headers > req.headers_end) req.headers = req.headers_end;
+
+  // Digits only, saturating just past what could fit: a huge or negative
+  // value must not wrap header_end + content_length into range
+  c.content_length = 0;
+  const char* length = req.header("Content-Length");
+  if (length) {
+    if (*length < '0' || *length > '9') return false;
+    for (; *length >= '0' && *length <= '9'; length++) {
+      if (c.content_length <= RX_BUFFER) c.content_length = c.content_length * 10 + (*length - '0');
+    }
+    while (*length == ' ' || *length == '\t') length++;
+    if (*length) return false;
+  }
+  return true;
+}
+
+void HttpServer::dispatch(Connection& c) {
+  const HttpRequest& req = c.req;
+  HttpResponse res;
+  res.buf = c.tx;
+  res.cap = TX_BUFFER;
+
+  const Route* route = nullptr;
+  bool path_found = false;
+  for (uint8_t i = 0; i < route_count; i++) {
+    const Route& r = routes[i];
+    if (strcmp(r.path, req.path) != 0) continue;
+    path_found = true;
+    if (r.verb == VERB_ANY || r.verb == req.verb || (r.verb == VERB_GET && req.verb == VERB_HEAD)) {
+      route = &r;
+      break;
+    }
+  }
+
+  if (!route) {
+    res.send(path_found ? 405 : 404, "text/plain", 0);
+  } else if (!route->handler) {
+    bool gzip = acceptsGzip(req.header("Accept-Encoding"));
+    const char* etag = gzip ? route->etag : route->raw_etag;
+    res.header("ETag", etag);
+    res.header("Cache-Control", "no-cache");
+    res.header("Vary", "Accept-Encoding");
+    const char* match = req.header("If-None-Match");
+    if (match && strcmp(match, etag) == 0) {
+      res.send(304, nullptr, 0);
+    } else if (gzip) {
+      res.header("Content-Encoding", "gzip");
+      res.sendStatic(200, route->type, route->data, route->len);
+    } else {
+      res.sendStatic(200, route->type, route->raw, route->raw_len);
+    }
+  } else {
+    route->handler(req, res);
+    if (res.status == 0) res.send(500, "text/plain", 0);
+  }
+
+  respond(c, res, req.verb);
+}
+
+void HttpServer::respond(Connection& c, const HttpResponse& res, HttpVerb verb) {
+  int n;
+  if (res.status == 304) {
+    n = snprintf(c.head, sizeof(c.head), "HTTP/1.1 304 Not Modified\r\n%sConnection: close\r\n\r\n",
+                 res.extra);
+  } else if (res.fill) {
+    n = snprintf(c.head, sizeof(c.head),
+                 "HTTP/1.1 %d %s\r\nContent-Type: %s\r\n%sConnection: close\r\n\r\n",
+                 res.status, statusText(res.status), res.type ? res.type : "text/plain", res.extra);
+  } else {
+    n = snprintf(c.head, sizeof(c.head),
+                 "HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %u\r\n%s"
+                 "Connection: close\r\n\r\n",
+                 res.status, statusText(res.status), res.type ? res.type : "text/plain",
+                 (unsigned)res.body_len, res.extra);
+  }
+  c.head_len = (n > 0 && (size_t)n < sizeof(c.head)) ? n : 0;
+  c.body = res.body;
+  c.body_len = (verb == VERB_HEAD || res.status == 304) ? 0 : res.body_len;
+  c.fill = (verb == VERB_HEAD) ? nullptr : res.fill;
+  c.part = 0;
+  c.sent = 0;
+  c.state = CONN_WRITING;
+}
+
+void HttpServer::reject(Connection& c, int status) {
+  total_rejected++;
+  HttpResponse res;
+  res.status = status;
+  respond(c, res, VERB_OTHER);
+}
+
+// Write what the socket takes right now, at most TX_CHUNK bytes
+void HttpServer::write(Connection& c, unsigned long now) {
+  size_t total = c.head_len + c.body_len;
+  size_t budget = TX_CHUNK;
+
+  while (budget > 0) {
+    if (c.sent >= total) {
+      // Streamed body: the buffer is free again, fill in the next part
+      size_t len = c.fill ? c.fill(c.part++, c.tx, TX_BUFFER) : 0;
+      if (len == 0) {
+        c.fill = nullptr;
+        break;
+      }
+      c.body = (const uint8_t*)c.tx;
+      c.body_len = len < TX_BUFFER ? len : TX_BUFFER;
+      c.head_len = 0;
+      c.sent = 0;
+      total = c.body_len;
+    }
+
+    const uint8_t* data;
+    size_t left;
+    if (c.sent < c.head_len) {
+      data = (const uint8_t*)c.head + c.sent;
+      left = c.head_len - c.sent;
+    } else {
+      data = c.body + (c.sent - c.head_len);
+      left = total - c.sent;
+    }
+    if (left > budget) left = budget;
+
+    int n = sendNow(c.client, data, left);
+    if (n < 0) {
+      close(c);
+      return;
+    }
+    if (n == 0) return;  // Window full: the rest goes out on a later poll
+    c.sent += n;
+    budget -= n;
+    c.last_activity = now;
+  }
+
+  if (c.sent >= total && !c.fill) close(c);
+}
+
+void HttpServer::close(Connection& c) {
+  c.client.stop();
+  c.client = WiFiClient();
+  c.state = CONN_FREE;
+}
@@ -17,19 +17,31 @@
  * - Adafruit GFX
  * - ArduinoJson
  * - Preferences (built-in)
- * - WebServer (built-in)
  */
 
 #include <WiFi.h>
 #include <WiFiManager.h>
 #include <WiFiUDP.h>
-#include <WebServer.h>
 #include <Preferences.h>
 #include <Wire.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
 #include <ArduinoJson.h>
 #include <time.h>
+#include <stdarg.h>
+#include <atomic>
+#include <mutex>
+#include "DisplayFlush.h"
+#include "StatsProtocol.h"
+#include "FrameMetrics.h"
+#include "HostTable.h"
+#include "MetricHistory.h"
+#include "Seqlock.h"
+#include "BigDigits.h"
+#include "MarioSprites.h"
+#include "WebAssets.h"
+#include "HttpServer.h"
+#include "NvsBlob.h"
 
 // ========== WiFi Portal Configuration ==========
 const char* AP_NAME = "PCMonitor-Setup";
@@ -40,7 +52,9 @@ WiFiUDP udp;
 const int UDP_PORT = 4210;
 
 // ========== Web Server ==========
-WebServer server(80);
+// Non-blocking: a slow client costs short poll() passes, never a stall
+HttpServer server(80);
+unsigned long wifi_reset_at = 0;  // Set by /reset: wipe WiFi once the reply is out
 Preferences preferences;
 
 // ========== Display Configuration ==========
@@ -48,8 +62,18 @@ Preferences preferences;
 #define SCREEN_HEIGHT 64
 #define SDA_PIN 8
 #define SCL_PIN 9
+#define OLED_ADDRESS 0x3C
+// I2C bus clock for the panel. Most SSD1306 modules run well past the
+// 400 kHz spec; try e.g. build_flags = -DOLED_I2C_CLOCK=800000 and watch
+// the display fps on /metrics.
+#ifndef OLED_I2C_CLOCK
+#define OLED_I2C_CLOCK 400000
+#endif
 Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
 
+// Only pages that changed since the last frame are sent over I2C
+DisplayFlush displayFlush(display, Wire, OLED_ADDRESS, OLED_I2C_CLOCK);
+
 // ========== NTP Time Configuration ==========
 const char* ntpServer = "pool.ntp.org";
 
@@ -60,6 +84,7 @@ struct Settings {
   bool daylightSaving;   // Daylight saving time
   bool use24Hour;        // 24-hour format
   int dateFormat;        // 0 = DD/MM/YYYY, 1 = MM/DD/YYYY, 2 = YYYY-MM-DD
+  int statsStyle;        // 0 = Bars, 1 = History graphs, 2 = Per-core bars
   char fanLabel[16];     // Custom label for fan/pump (e.g., "PUMP", "FAN", "COOLER")
   char cpuLabel[16];     // Custom label for CPU
   char ramLabel[16];     // Custom label for RAM
@@ -69,6 +94,93 @@ struct Settings {
 
 Settings settings;
 
+// `settings` belongs to the render task, which reads it every frame. The
+// HTTP task works on web_settings instead; a save writes it under
+// settings_mutex and raises settings_changed, and the renderer copies it
+// into `settings` under the same mutex before its next frame. (The seqlock
+// would have its lowest-priority task as the writer, so it doesn't fit.)
+Settings web_settings;
+std::mutex settings_mutex;
+
+// Stored as one CRC-checked blob under "settings" in the "pcmonitor"
+// namespace. Bump the version when the Settings layout changes.
+const uint16_t SETTINGS_VERSION = 1;
+Settings saved_settings;  // What NVS holds; saves that change nothing are skipped
+
+// One key per field, as stored before the blob; migrated on first boot
+const char* const LEGACY_SETTINGS_KEYS[] = {
+  "clockStyle", "gmtOffset", "dst", "use24Hour", "dateFormat", "statsStyle",
+  "fanLabel", "cpuLabel", "ramLabel", "gpuLabel", "diskLabel"
+};
+
+// ========== Fast Boot ==========
+// After every successful connect the AP's channel and BSSID and the DHCP
+// lease are cached in NVS ("wifiCache"). The next boot joins that AP
+// directly with the cached address, skipping the scan and DHCP, and only
+// falls back to WiFiManager if that hasn't worked within
+// FAST_CONNECT_TIMEOUT. The cache holds a CRC of the SSID, not the
+// credentials, so joining another network through the portal invalidates
+// it. Build with -DFAST_BOOT=0 on networks where the lease may move.
+#ifndef FAST_BOOT
+#define FAST_BOOT 1
+#endif
+const uint16_t WIFI_CACHE_VERSION = 1;
+const unsigned long FAST_CONNECT_TIMEOUT = 3000;
+const unsigned long SPLASH_DURATION = 5000;  // IP screen, cut short by the first stats
+
+struct WifiCache {
+  uint32_t ssid_crc;
+  int32_t channel;
+  uint8_t bssid[6];
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+};
+
+unsigned long splash_until = 0;  // Renderer shows the IP screen until then
+
+// Milliseconds since power-on at each boot stage, logged and on /metrics
+struct BootStage {
+  const char* name;
+  unsigned long ms;
+};
+const int MAX_BOOT_STAGES = 12;
+BootStage boot_stages[MAX_BOOT_STAGES];
+int boot_stage_count = 0;
+bool boot_time_synced = false;
+bool boot_stats_shown = false;
+
+// ========== WiFi Reconnect ==========
+// A dropped link is rejoined in place instead of rebooting: the render
+// task keeps drawing the clock while serviceWifi() retries with
+// exponential backoff, so hosts, history and counters survive an AP
+// restart. The first attempt joins the last AP directly (cached channel
+// and BSSID), later ones scan. Once the link is back the UDP and HTTP
+// tasks rebind their sockets. Only after WIFI_REBOOT_AFTER ms offline
+// does it give up and reboot (0 = never).
+#ifndef WIFI_REBOOT_AFTER
+#define WIFI_REBOOT_AFTER 600000UL
+#endif
+const unsigned long WIFI_RETRY_MIN = 250;
+const unsigned long WIFI_RETRY_MAX = 30000;
+const unsigned long WIFI_ATTEMPT_TIMEOUT = 8000;  // Scan + association + DHCP
+
+enum LinkState { LINK_UP, LINK_BACKOFF, LINK_JOINING };
+LinkState link_state = LINK_UP;
+unsigned long link_lost_at = 0;
+unsigned long link_deadline = 0;     // Next attempt, or end of the current one
+unsigned long link_retry_delay = WIFI_RETRY_MIN;
+uint8_t link_attempt = 0;            // Attempts in this outage
+WifiCache link_cache;                // How we last got on the network
+bool link_cache_valid = false;
+std::atomic<bool> udp_rebind(false);
+std::atomic<bool> http_rebind(false);
+
+unsigned long wifi_disconnects = 0;
+unsigned long wifi_attempts = 0;
+unsigned long wifi_last_outage_ms = 0;
+
 // ========== PC Stats Structure ==========
 struct PCStats {
   float cpu_percent;
@@ -81,20 +193,99 @@ struct PCStats {
   int fan_speed;
   char timestamp[6];
   bool online;
+  uint8_t core_count;               // 0 = sender sends no per-core load
+  uint8_t cores[STATS_MAX_CORES];   // 0.5 % steps, 0-200
+};
+
+// Last 128 samples per host, one byte per sample (640 bytes per host). At
+// most one sample per HISTORY_INTERVAL, so the graphs cover the same ~6
+// minutes at the default 3 s send interval and with a sub-second sender.
+const unsigned long HISTORY_INTERVAL = 2500;
+
+struct StatsHistory {
+  MetricHistory<uint8_t> cpu_percent;  // 0.5 % steps
+  MetricHistory<uint8_t> ram_percent;  // 0.5 % steps
+  MetricHistory<int8_t> cpu_temp;      // deg C
+  MetricHistory<int8_t> gpu_temp;      // deg C
+  MetricHistory<uint8_t> fan_speed;    // 32 RPM steps
 };
 
-PCStats stats;
-unsigned long lastReceived = 0;
 const unsigned long TIMEOUT = 6000;
 
+// ========== Hosts ==========
+// Several PCs can send to one display. Each gets its own stats page, keyed
+// by the host ID in the payload or, without one, by the sender's IP address.
+// The stats screen rotates through the hosts that are online.
+const uint8_t MAX_HOSTS = 8;
+const unsigned long HOST_PAGE_INTERVAL = 5000;
+
+// Sender clock (send_ms) against ours, as the smallest arrival offset
+// seen over the last one to two windows of SEND_CLOCK_WINDOW packets: the
+// packet that got through fastest. How far a packet sits above that is
+// its delay beyond the best case; the clocks themselves aren't synced.
+const uint8_t SEND_CLOCK_WINDOW = 64;
+const int32_t SEND_CLOCK_RESET = 10000000;  // us; beyond this the sender restarted
+
+struct SendClock {
+  uint32_t min_now;   // Smallest offset (us) in the current window
+  uint32_t min_prev;  // ... and in the previous one
+  uint8_t count;
+  bool valid;
+};
+
+struct HostStats {
+  PCStats stats;
+  StatsHistory history;
+  unsigned long lastReceived;
+  uint32_t ip;
+  uint8_t host_id;  // 0 = keyed by IP
+  uint32_t rx_us;   // micros() when the newest data arrived, 0 = untimed
+  SendClock send_clock;
+  unsigned long history_at;  // millis() of the newest history sample
+  uint16_t cadence_ms;       // Average time between packets, 0 = unknown
+};
+HostTable<HostStats, MAX_HOSTS> hosts;
+int shown_host = -1;             // Slot on screen, -1 = none
+int shown_page = 0;              // 1-based position among online hosts
+int hosts_online = 0;
+unsigned long host_page_since = 0;
+bool hosts_changed = false;      // Parsed a packet since the last publish
+
+// Everything the renderer needs from the hosts table. The UDP task owns
+// `hosts` and publishes this through a seqlock; the renderer copies it
+// out at the start of a frame and never touches `hosts` itself.
+struct StatsSnapshot {
+  bool online;        // Any host online
+  PCStats stats;      // Host on screen
+  StatsHistory history;
+  uint32_t ip;
+  uint8_t host_id;
+  int page;
+  int hosts_online;
+  uint32_t rx_us;     // When the data on screen arrived
+  uint16_t cadence_ms;
+};
+Seqlock<StatsSnapshot> stats_snapshot;
+StatsSnapshot screen;             // Renderer's copy
+uint32_t screen_version = 0;
+
 // ========== Mario Animation Variables ==========
-float mario_x = -15;
+// Positions and velocities are fixed-point in tenths of a pixel (FX = 1 px).
+// Every physics constant is a whole number of tenths, so the integer math
+// is exact and needs no soft-float calls. Motion advances in fixed
+// MARIO_ANIM_SPEED / DIGIT_BOUNCE_SPEED steps, catching up after a late
+// frame, so its speed doesn't depend on the frame rate.
+const int FX = 10;
+const int MAX_CATCHUP_STEPS = 5;  // Beyond this, restart the timestep instead
+
+int mario_x = -15 * FX;
 int mario_base_y = 62;
-float mario_jump_y = 0;
+int mario_jump_y = 0;
 bool mario_facing_right = true;
 int mario_walk_frame = 0;
 unsigned long last_mario_update = 0;
 const int MARIO_ANIM_SPEED = 50;
+const int MARIO_WALK_SPEED = 25;  // 2.5 px per step
 
 enum MarioState {
   MARIO_IDLE,
@@ -114,9 +305,10 @@ int last_minute = -1;
 bool animation_triggered = false;
 
 // Jump physics
-float jump_velocity = 0;
-const float GRAVITY = 0.6;
-const float JUMP_POWER = -4.5;
+int jump_velocity = 0;
+const int GRAVITY = 6;          // 0.6 px per step, per step
+const int JUMP_POWER = -45;
+const int HIT_REBOUND = 20;     // Downward speed after hitting a digit
 bool digit_bounce_triggered = false;
 
 const int MARIO_HEAD_OFFSET = 10;
@@ -128,24 +320,152 @@ int displayed_min = -1;
 bool time_overridden = false;
 
 // Digit bounce animation
-float digit_offset_y[5] = {0, 0, 0, 0, 0};
-float digit_velocity[5] = {0, 0, 0, 0, 0};
-const float DIGIT_BOUNCE_POWER = -3.5;
-const float DIGIT_GRAVITY = 0.6;
+int digit_offset_y[5] = {0, 0, 0, 0, 0};
+int digit_velocity[5] = {0, 0, 0, 0, 0};
+const int DIGIT_BOUNCE_POWER = -35;
+const int DIGIT_GRAVITY = 6;
+unsigned long last_bounce_update = 0;
+const int DIGIT_BOUNCE_SPEED = 30;  // Physics step, independent of frame rate
 
 const int DIGIT_X[5] = {19, 37, 55, 73, 91};
 const int TIME_Y = 26;
 
+// ========== Stats Screen Background ==========
+// Labels, ":" separators and bar frames only change with the settings, so
+// they are drawn once into a cached frame. Each stats frame starts from a
+// copy of it and draws just the values and bar fills.
+enum StatsLine { LINE_FAN, LINE_RAM, LINE_CPU, LINE_GPU, LINE_DISK, LINE_COUNT };
+uint8_t stats_background[SCREEN_WIDTH * SCREEN_HEIGHT / 8];
+bool stats_background_valid = false;
+int16_t stats_value_x[LINE_COUNT];  // Text cursor after each label, where
+int16_t stats_value_y[LINE_COUNT];  // the value starts (long labels wrap)
+
+// ========== Stats Tweening ==========
+// Bars and numbers on the stats screen ease from the value on screen to
+// the newest one over the host's measured packet interval instead of
+// jumping. Values are fixed-point tenths with an integer ease-out, and
+// frames are scheduled only while a tween is still moving; a settled
+// screen goes back to being redrawn on new data only.
+enum TweenMetric { TWEEN_FAN, TWEEN_RAM, TWEEN_CPU, TWEEN_CPU_TEMP, TWEEN_GPU, TWEEN_DISK, TWEEN_COUNT };
+const unsigned long TWEEN_FRAME_INTERVAL = 40;  // ~25 fps while moving
+const unsigned long TWEEN_MAX_DURATION = 5000;
+const int32_t TWEEN_ONE = 1024;                 // Progress fixed-point scale
+
+struct Tween {
+  int32_t from;             // Tenths
+  int32_t to;
+  unsigned long start;      // millis()
+  unsigned long duration;   // 0 = settled at `to`
+};
+Tween tweens[TWEEN_COUNT];
+uint64_t tween_host = 0;    // Host the tweens belong to; another one snaps
+bool tween_valid = false;
+
+// ========== Frame Scheduler ==========
+// A frame is rendered only when something invalidated the screen (new
+// stats snapshot, settings change) or a renderer's deadline is due (clock
+// tick, animation step). In between, the render task sleeps.
+std::atomic<bool> frame_invalid(true);
+std::atomic<bool> settings_changed(false);
+unsigned long next_frame_at = 0;
+const unsigned long IDLE_FRAME_INTERVAL = 60000;  // Redraw at least this often
+const unsigned long NETWORK_POLL_INTERVAL = 10;   // Max sleep between network checks
+
+// ========== Tasks ==========
+// UDP receive/parse, the HTTP server and the renderer (loop()) run as
+// separate FreeRTOS tasks, so a slow page load or I2C transfer never holds
+// up packets. UDP gets the highest priority: it is short and is the seqlock
+// writer. The host build has no scheduler and runs all three from loop().
+// The I2C transfer itself runs on DisplayFlush's task, so the renderer draws
+// the next frame while the previous one is on the bus.
+const int UDP_TASK_PRIORITY = 3;
+const int RENDER_TASK_PRIORITY = 2;
+const int FLUSH_TASK_PRIORITY = 2;
+const int HTTP_TASK_PRIORITY = 1;
+const uint32_t UDP_TASK_STACK = 6144;
+const uint32_t HTTP_TASK_STACK = 8192;
+
+// ========== UDP Receive ==========
+// Every UDP task pass drains the socket completely. Only the newest datagram
+// per sender is kept and parsed, so a burst never leaves the screen more
+// than one frame behind. A delta (see StatsProtocol.h) only updates the
+// fields it carries, so the one before it is parsed rather than dropped;
+// after a sequence gap the sender is asked for a keyframe, since the lost
+// delta may have been the only one to carry a change.
+const int UDP_BUFFER_SIZE = 1024;  // JSON with 64 per-core loads is ~600 B
+const int MAX_DRAIN_PER_LOOP = 32;     // Bounds a single pass under flood
+const int16_t SEQ_REORDER_WINDOW = 256;  // Older than this = sender restarted
+const unsigned long KEYFRAME_REQUEST_INTERVAL = 1000;  // ms, per sender
+
+struct UdpSource {
+  uint32_t ip;
+  uint16_t port;
+  unsigned long last_seen;
+  uint16_t last_seq;         // Newest accepted sequence number
+  bool have_seq;
+  bool synced;               // Keyframe seen since the last gap
+  bool keyframe_requested;
+  unsigned long keyframe_requested_at;
+  int pending_len;           // Newest unparsed datagram, 0 = none
+  uint32_t pending_rx_us;    // ... and micros() when it arrived
+  char pending[UDP_BUFFER_SIZE];
+};
+HostTable<UdpSource, MAX_HOSTS> udp_sources;  // Keyed by IP and port
+
+// ========== Metrics ==========
+// Cycle-counter timings per loop() stage, served on /metrics
+enum LoopStage {
+  STAGE_HTTP,    // server.poll(), HTTP task
+  STAGE_UDP,     // udp.parsePacket() + parseStats(), packets only, UDP task
+  STAGE_RENDER,  // clearDisplay() + screen drawing
+  STAGE_FLUSH,   // Hand-off to the I2C flush task, incl. waiting for the last frame
+  STAGE_FRAME,   // Whole render pass that produced a frame
+  STAGE_COUNT
+};
+const char* const STAGE_NAMES[STAGE_COUNT] = {"http", "udp", "render", "flush", "frame"};
+StageStats stage_stats[STAGE_COUNT];
+RateCounter frame_rate;
+
+// Per-packet latency in microseconds, from arrival: until parsed, and
+// until the first frame showing it is on the panel. `network` is the delay
+// above the fastest packet from the same sender (see SendClock).
+enum LatencyStage { LATENCY_NETWORK, LATENCY_PARSE, LATENCY_DISPLAY, LATENCY_COUNT };
+const char* const LATENCY_NAMES[LATENCY_COUNT] = {"network", "parse", "display"};
+StageStats latency_stats[LATENCY_COUNT];
+uint64_t tagged_host = 0;    // Renderer: host and data of the last frame,
+uint32_t tagged_rx_us = 0;   // to tag the first frame showing new data
+
+unsigned long packets_received = 0;
+unsigned long packets_dropped = 0;    // Sequence gaps
+unsigned long packets_malformed = 0;  // Failed to parse
+unsigned long packets_coalesced = 0;  // Superseded by a newer one in the same drain
+unsigned long packets_stale = 0;      // Duplicate or out-of-order sequence number
+unsigned long packets_reordered = 0;  // ... of those, the out-of-order ones
+unsigned long packets_delta = 0;      // Deltas among the parsed packets
+unsigned long keyframe_requests = 0;
+
 // ========== WiFiManager ==========
 WiFiManager wifiManager;
 
 // Forward declarations
+void bootStage(const char* name);
+bool fastConnect();
+void saveWifiCache();
+void serviceWifi(unsigned long now);
+void beginWifiAttempt();
 void loadSettings();
-void saveSettings();
+void loadLegacySettings();
+void loadLegacyLabel(const char* key, char* dest, const char* fallback);
+void migrateLegacySettings();
+void saveSettings(const Settings& s);
 void setupWebServer();
-void handleRoot();
-void handleSave();
-void handleReset();
+void handleSettings(const HttpRequest& req, HttpResponse& res);
+void handleSave(const HttpRequest& req, HttpResponse& res);
+void handleReset(const HttpRequest& req, HttpResponse& res);
+void handleMetrics(const HttpRequest& req, HttpResponse& res);
+size_t metricsPart(int part, char* body, size_t cap);
+size_t appendf(char* buf, size_t size, size_t len, const char* fmt, ...);
+size_t appendJsonString(char* buf, size_t size, size_t len, const char* key, const char* value);
 void displaySetupInstructions();
 void displayConnecting();
 void displayConnected();
@@ -158,17 +478,49 @@ void calculateTargetDigits(int hour, int min);
 void advanceDisplayedTime();
 void updateSpecificDigit(int digitIndex, int newValue);
 void updateDigitBounce();
+void digitBounceStep();
+bool digitsBouncing();
+void marioStep(struct tm* timeinfo);
 void triggerDigitBounce(int digitIndex);
 void drawTimeWithBounce();
 void applyTimezone();
 void configModeCallback(WiFiManager *myWiFiManager);
 void saveConfigCallback();
-void parseStats(const char* json);
+void startNetworkTasks();
+void udpTask(void* arg);
+void httpTask(void* arg);
+void serviceUdp();
+void serviceHttp();
+void publishSnapshot();
+void readSnapshot();
+void resetClockAnimation();
+bool receivePackets();
+UdpSource* findUdpSource(uint32_t ip, uint16_t port, unsigned long now);
+bool acceptSequence(UdpSource* src, const char* data, int len, unsigned long now);
+void requestKeyframe(UdpSource* src, unsigned long now);
+bool jsonPeekSeq(const char* json, uint16_t& seq);
+void parseStats(const char* data, int len, uint32_t ip, uint32_t rx_us);
+bool parseBinaryStats(const uint8_t* data, int len, uint32_t ip, uint32_t rx_us);
+bool parseJsonStats(const char* json, int len, uint32_t ip, uint32_t rx_us);
+void recordArrival(HostStats& entry, uint32_t rx_us, bool has_send_time, uint32_t send_ms);
+void recordDisplayLatency(uint32_t rx_us);
+HostStats* hostEntry(uint8_t host_id, uint32_t ip);
+void recordHistory(HostStats& entry);
+bool updateHostPages(unsigned long now);
 void displayStats();
+void updateStatsTweens(unsigned long now);
+void tweenTo(Tween& t, int32_t target, unsigned long now, unsigned long duration);
+int32_t tweenValue(Tween& t, unsigned long now);
+void buildStatsBackground();
+void displayHistory();
+void displayCores();
+void invalidateFrame();
+void scheduleFrameIn(unsigned long ms);
+unsigned long msUntilClockSecond(int second);
 
 void setup() {
   Serial.begin(115200);
-  delay(1000);
+  bootStage("serial");
   
   Serial.println("\n========================================");
   Serial.println("PC Stats Monitor - Web Config Version");
@@ -176,13 +528,17 @@ void setup() {
   
   // Load settings from flash
   loadSettings();
+  web_settings = settings;
+  bootStage("settings");
   
   Wire.begin(SDA_PIN, SCL_PIN);
   
-  if(!display.begin(SSD1306_SWITCHCAPVCC, 0x3C)) {
+  if(!display.begin(SSD1306_SWITCHCAPVCC, OLED_ADDRESS)) {
     Serial.println("ERROR: Display initialization failed!");
     while(1);
   }
+  displayFlush.start(FLUSH_TASK_PRIORITY);
+  displayFlush.onFrameSent(recordDisplayLatency);
   
   display.clearDisplay();
   display.setTextColor(SSD1306_WHITE);
@@ -191,35 +547,39 @@ void setup() {
   display.println("PC Monitor");
   display.setCursor(10, 35);
   display.println("Starting...");
-  display.display();
-  
-  wifiManager.setConfigPortalTimeout(180);
-  wifiManager.setAPCallback(configModeCallback);
-  wifiManager.setSaveConfigCallback(saveConfigCallback);
+  displayFlush.flush();
+  bootStage("display");
   
   Serial.println("Attempting WiFi connection...");
   
-  if (!wifiManager.autoConnect(AP_NAME, AP_PASSWORD)) {
-    Serial.println("Failed to connect and hit timeout");
-    display.clearDisplay();
-    display.setCursor(10, 20);
-    display.println("WiFi Timeout!");
-    display.setCursor(10, 35);
-    display.println("Restarting...");
-    display.display();
-    delay(3000);
-    ESP.restart();
+  if (fastConnect()) {
+    bootStage("wifi-fast");
+  } else {
+    wifiManager.setConfigPortalTimeout(180);
+    wifiManager.setAPCallback(configModeCallback);
+    wifiManager.setSaveConfigCallback(saveConfigCallback);
+    
+    if (!wifiManager.autoConnect(AP_NAME, AP_PASSWORD)) {
+      Serial.println("Failed to connect and hit timeout");
+      display.clearDisplay();
+      display.setCursor(10, 20);
+      display.println("WiFi Timeout!");
+      display.setCursor(10, 35);
+      display.println("Restarting...");
+      displayFlush.flush();
+      delay(3000);
+      ESP.restart();
+    }
+    bootStage("wifi");
   }
   
+  WiFi.setAutoReconnect(false);  // serviceWifi() owns retries and backoff
+  
   Serial.println("WiFi Connected!");
   Serial.print("IP Address: ");
   Serial.println(WiFi.localIP());
   
-  // Apply timezone and start NTP
-  applyTimezone();
-  Serial.println("NTP time synchronized");
-  
-  // Start UDP listener
+  // Start UDP listener first: stats can arrive as soon as we are on the network
   udp.begin(UDP_PORT);
   Serial.print("UDP listening on port ");
   Serial.println(UDP_PORT);
@@ -228,14 +588,166 @@ void setup() {
   setupWebServer();
   Serial.println("Web server started on port 80");
   
-  // Show IP address for 5 seconds
-  displayConnected();
-  delay(5000);
+  startNetworkTasks();
+  bootStage("network");
+  
+  // Timezone and NTP: SNTP syncs in the background, the clock screens
+  // say so until it has
+  applyTimezone();
+  
+  // The renderer shows the IP until SPLASH_DURATION is up or stats arrive
+  splash_until = millis() + SPLASH_DURATION;
+  invalidateFrame();
+  
+  saveWifiCache();
+  bootStage("setup");
   
   Serial.println("Setup complete!");
   Serial.println("========================================");
 }
 
+void bootStage(const char* name) {
+  unsigned long now = millis();
+  Serial.printf("[boot] %6lu ms  %s\n", now, name);
+  if (boot_stage_count < MAX_BOOT_STAGES) {
+    boot_stages[boot_stage_count].name = name;
+    boot_stages[boot_stage_count].ms = now;
+    boot_stage_count++;
+  }
+}
+
+// Join the cached AP with the cached lease; false if there is no usable
+// cache or it didn't connect in time, with WiFi left ready for WiFiManager
+bool fastConnect() {
+#if FAST_BOOT
+  WifiCache cache;
+  preferences.begin("pcmonitor", true);
+  bool cached = loadNvsBlob(preferences, "wifiCache", WIFI_CACHE_VERSION, cache);
+  preferences.end();
+  if (!cached) return false;
+  
+  WiFi.persistent(false);  // Don't rewrite the stored credentials every boot
+  WiFi.mode(WIFI_STA);
+  String ssid = WiFi.SSID();
+  String psk = WiFi.psk();
+  if (ssid.length() == 0 || nvsCrc32(ssid.c_str(), ssid.length()) != cache.ssid_crc) {
+    WiFi.persistent(true);
+    return false;
+  }
+  
+  WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway), IPAddress(cache.subnet),
+              IPAddress(cache.dns));
+  WiFi.begin(ssid.c_str(), psk.c_str(), cache.channel, cache.bssid);
+  unsigned long start = millis();
+  while (WiFi.status() != WL_CONNECTED && millis() - start < FAST_CONNECT_TIMEOUT) {
+    delay(10);
+  }
+  WiFi.persistent(true);
+  if (WiFi.status() == WL_CONNECTED) return true;
+  
+  Serial.println("Fast connect failed, scanning");
+  WiFi.disconnect();
+  WiFi.config(IPAddress(), IPAddress(), IPAddress());  // Back to DHCP
+#endif
+  return false;
+}
+
+// Remember how we got on the network, for reconnects and (in NVS, only
+// written when something changed) the next boot. Render task only, like
+// beginWifiAttempt() which reads link_cache; its own NVS handle, since the
+// HTTP task may be saving settings through `preferences` meanwhile.
+void saveWifiCache() {
+  WifiCache cache;
+  memset(&cache, 0, sizeof(cache));
+  String ssid = WiFi.SSID();
+  cache.ssid_crc = nvsCrc32(ssid.c_str(), ssid.length());
+  cache.channel = WiFi.channel();
+  memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+  cache.ip = WiFi.localIP();
+  cache.gateway = WiFi.gatewayIP();
+  cache.subnet = WiFi.subnetMask();
+  cache.dns = WiFi.dnsIP(0);
+  link_cache = cache;
+  link_cache_valid = true;
+  
+#if FAST_BOOT
+  WifiCache stored;
+  Preferences nvs;
+  nvs.begin("pcmonitor", false);
+  if (!loadNvsBlob(nvs, "wifiCache", WIFI_CACHE_VERSION, stored) ||
+      memcmp(&stored, &cache, sizeof(cache)) != 0) {
+    saveNvsBlob(nvs, "wifiCache", WIFI_CACHE_VERSION, cache);
+    Serial.println("WiFi fast-boot cache updated");
+  }
+  nvs.end();
+#endif
+}
+
+// Link supervision, called by the render task every pass. Never blocks:
+// each call looks at the link and at most starts one attempt.
+void serviceWifi(unsigned long now) {
+  bool connected = WiFi.status() == WL_CONNECTED;
+  
+  if (link_state == LINK_UP) {
+    if (connected) return;
+    wifi_disconnects++;
+    link_state = LINK_BACKOFF;
+    link_lost_at = now;
+    link_attempt = 0;
+    link_retry_delay = WIFI_RETRY_MIN;
+    link_deadline = now + WIFI_RETRY_MIN;
+    Serial.println("WiFi lost, reconnecting");
+    return;
+  }
+  
+  if (connected) {
+    wifi_last_outage_ms = now - link_lost_at;
+    link_state = LINK_UP;
+    Serial.printf("WiFi back after %lu ms (%u attempts), IP ", wifi_last_outage_ms,
+                  (unsigned)link_attempt);
+    Serial.println(WiFi.localIP());
+    saveWifiCache();  // The AP or lease may have changed
+    udp_rebind = true;
+    http_rebind = true;
+    return;
+  }
+  
+  if (WIFI_REBOOT_AFTER && now - link_lost_at >= WIFI_REBOOT_AFTER) {
+    Serial.println("WiFi still down, restarting...");
+    ESP.restart();
+  }
+  
+  if ((long)(now - link_deadline) < 0) return;
+  
+  if (link_state == LINK_JOINING) {
+    // This attempt timed out: abandon it and back off
+    WiFi.disconnect();
+    link_state = LINK_BACKOFF;
+    link_deadline = now + link_retry_delay;
+    link_retry_delay = min(link_retry_delay * 2, WIFI_RETRY_MAX);
+    return;
+  }
+  
+  beginWifiAttempt();
+  link_state = LINK_JOINING;
+  link_deadline = now + WIFI_ATTEMPT_TIMEOUT;
+}
+
+void beginWifiAttempt() {
+  link_attempt++;
+  wifi_attempts++;
+  String ssid = WiFi.SSID();
+  String psk = WiFi.psk();
+  WiFi.persistent(false);  // Same credentials: don't rewrite flash per attempt
+  if (link_attempt == 1 && link_cache_valid) {
+    // Most outages are the AP rebooting: skip the scan
+    WiFi.begin(ssid.c_str(), psk.c_str(), link_cache.channel, link_cache.bssid);
+  } else {
+    WiFi.begin(ssid.c_str(), psk.c_str());
+  }
+  WiFi.persistent(true);
+}
+
 void configModeCallback(WiFiManager *myWiFiManager) {
   Serial.println("Entered config mode");
   displaySetupInstructions();
@@ -248,38 +760,26 @@ void saveConfigCallback() {
 
 void loadSettings() {
   preferences.begin("pcmonitor", true);  // Read-only
-  settings.clockStyle = preferences.getInt("clockStyle", 0);  // Default: Mario
-  settings.gmtOffset = preferences.getInt("gmtOffset", 1);    // Default: GMT+1
-  settings.daylightSaving = preferences.getBool("dst", true); // Default: true
-  settings.use24Hour = preferences.getBool("use24Hour", true); // Default: 24h
-  settings.dateFormat = preferences.getInt("dateFormat", 0);  // Default: DD/MM/YYYY
-
-  // Load custom labels with defaults
-  String fanLbl = preferences.getString("fanLabel", "PUMP");
-  String cpuLbl = preferences.getString("cpuLabel", "CPU");
-  String ramLbl = preferences.getString("ramLabel", "RAM");
-  String gpuLbl = preferences.getString("gpuLabel", "GPU");
-  String diskLbl = preferences.getString("diskLabel", "DISK");
-
-  strncpy(settings.fanLabel, fanLbl.c_str(), 15);
-  strncpy(settings.cpuLabel, cpuLbl.c_str(), 15);
-  strncpy(settings.ramLabel, ramLbl.c_str(), 15);
-  strncpy(settings.gpuLabel, gpuLbl.c_str(), 15);
-  strncpy(settings.diskLabel, diskLbl.c_str(), 15);
-  settings.fanLabel[15] = '\0';
-  settings.cpuLabel[15] = '\0';
-  settings.ramLabel[15] = '\0';
-  settings.gpuLabel[15] = '\0';
-  settings.diskLabel[15] = '\0';
-
+  bool loaded = loadNvsBlob(preferences, "settings", SETTINGS_VERSION, settings);
+  bool legacy = !loaded && preferences.isKey("clockStyle");
+  if (!loaded) {
+    loadLegacySettings();  // Also fills in the defaults when nothing is stored
+  }
   preferences.end();
 
-  Serial.println("Settings loaded:");
+  if (loaded) {
+    saved_settings = settings;
+  } else if (legacy) {
+    migrateLegacySettings();
+  }
+
+  Serial.println(loaded ? "Settings loaded:" : legacy ? "Settings migrated:" : "Settings (defaults):");
   Serial.print("  Clock Style: "); Serial.println(settings.clockStyle);
   Serial.print("  GMT Offset: "); Serial.println(settings.gmtOffset);
   Serial.print("  DST: "); Serial.println(settings.daylightSaving ? "Yes" : "No");
   Serial.print("  24-Hour: "); Serial.println(settings.use24Hour ? "Yes" : "No");
   Serial.print("  Date Format: "); Serial.println(settings.dateFormat);
+  Serial.print("  Stats Style: "); Serial.println(settings.statsStyle);
   Serial.print("  Fan Label: "); Serial.println(settings.fanLabel);
   Serial.print("  CPU Label: "); Serial.println(settings.cpuLabel);
   Serial.print("  RAM Label: "); Serial.println(settings.ramLabel);
@@ -287,21 +787,57 @@ void loadSettings() {
   Serial.print("  Disk Label: "); Serial.println(settings.diskLabel);
 }
 
-void saveSettings() {
+// Per-key layout with the original defaults; preferences must be open
+void loadLegacySettings() {
+  memset(&settings, 0, sizeof(settings));  // Zero padding and label tails for the CRC
+  settings.clockStyle = preferences.getInt("clockStyle", 0);  // Default: Mario
+  settings.gmtOffset = preferences.getInt("gmtOffset", 1);    // Default: GMT+1
+  settings.daylightSaving = preferences.getBool("dst", true); // Default: true
+  settings.use24Hour = preferences.getBool("use24Hour", true); // Default: 24h
+  settings.dateFormat = preferences.getInt("dateFormat", 0);  // Default: DD/MM/YYYY
+  settings.statsStyle = preferences.getInt("statsStyle", 0);  // Default: Bars
+
+  // Load custom labels with defaults
+  loadLegacyLabel("fanLabel", settings.fanLabel, "PUMP");
+  loadLegacyLabel("cpuLabel", settings.cpuLabel, "CPU");
+  loadLegacyLabel("ramLabel", settings.ramLabel, "RAM");
+  loadLegacyLabel("gpuLabel", settings.gpuLabel, "GPU");
+  loadLegacyLabel("diskLabel", settings.diskLabel, "DISK");
+}
+
+void loadLegacyLabel(const char* key, char* dest, const char* fallback) {
+  if (preferences.getString(key, dest, 16) == 0) {
+    strncpy(dest, fallback, 15);
+  }
+  dest[15] = '\0';
+}
+
+// Write the blob, then drop the old keys so this only happens once
+void migrateLegacySettings() {
+  saveSettings(settings);
+  preferences.begin("pcmonitor", false);
+  for (const char* key : LEGACY_SETTINGS_KEYS) {
+    preferences.remove(key);
+  }
+  preferences.end();
+}
+
+void saveSettings(const Settings& s) {
+  if (memcmp(&s, &saved_settings, sizeof(s)) == 0) {
+    Serial.println("Settings unchanged, nothing written");
+    return;
+  }
+
   preferences.begin("pcmonitor", false);  // Read-write
-  preferences.putInt("clockStyle", settings.clockStyle);
-  preferences.putInt("gmtOffset", settings.gmtOffset);
-  preferences.putBool("dst", settings.daylightSaving);
-  preferences.putBool("use24Hour", settings.use24Hour);
-  preferences.putInt("dateFormat", settings.dateFormat);
-  preferences.putString("fanLabel", settings.fanLabel);
-  preferences.putString("cpuLabel", settings.cpuLabel);
-  preferences.putString("ramLabel", settings.ramLabel);
-  preferences.putString("gpuLabel", settings.gpuLabel);
-  preferences.putString("diskLabel", settings.diskLabel);
+  bool ok = saveNvsBlob(preferences, "settings", SETTINGS_VERSION, s);
   preferences.end();
 
-  Serial.println("Settings saved!");
+  if (ok) {
+    saved_settings = s;
+    Serial.println("Settings saved!");
+  } else {
+    Serial.println("ERROR: Settings save failed!");
+  }
 }
 
 void applyTimezone() {
@@ -310,244 +846,261 @@ void applyTimezone() {
   configTime(gmtOffset_sec, dstOffset_sec, ntpServer);
 }
 
+// Static pages are in flash (include/WebAssets.h), gzipped plus a plain
+// copy, and served from there with their ETag, so a reload is usually a
+// bodyless 304
 void setupWebServer() {
-  server.on("/", handleRoot);
-  server.on("/save", HTTP_POST, handleSave);
-  server.on("/reset", handleReset);
+  for (const WebAsset& asset : WEB_ASSETS) {
+    server.onStatic(asset.path, asset.type, asset.data, asset.len, asset.etag,
+                    asset.raw, asset.raw_len, asset.raw_etag);
+  }
+  server.on("/api/settings", VERB_GET, handleSettings);
+  server.on("/api/settings", VERB_POST, handleSave);
+  server.on("/reset", VERB_POST, handleReset);
+  server.on("/metrics", VERB_GET, handleMetrics);
   server.begin();
 }
 
-void handleRoot() {
-  String html = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-  <meta name="viewport" content="width=device-width, initial-scale=1">
-  <title>PC Monitor Settings</title>
-  <style>
-    body { font-family: Arial, sans-serif; margin: 20px; background: #1a1a2e; color: #eee; }
-    .container { max-width: 400px; margin: 0 auto; }
-    h1 { color: #00d4ff; text-align: center; }
-    .card { background: #16213e; padding: 20px; border-radius: 10px; margin-bottom: 20px; }
-    label { display: block; margin: 15px 0 5px; color: #00d4ff; }
-    select, input { width: 100%; padding: 10px; border: none; border-radius: 5px; background: #0f3460; color: #fff; font-size: 16px; }
-    select:focus, input:focus { outline: 2px solid #00d4ff; }
-    button { width: 100%; padding: 15px; margin-top: 20px; border: none; border-radius: 5px; font-size: 18px; cursor: pointer; }
-    .save-btn { background: #00d4ff; color: #1a1a2e; }
-    .save-btn:hover { background: #00a8cc; }
-    .reset-btn { background: #e94560; color: #fff; }
-    .reset-btn:hover { background: #c73e54; }
-    .info { text-align: center; color: #888; font-size: 12px; margin-top: 20px; }
-    .status { background: #0f3460; padding: 10px; border-radius: 5px; text-align: center; margin-bottom: 20px; }
-  </style>
-</head>
-<body>
-  <div class="container">
-    <h1>&#128421; PC Monitor</h1>
-    <div class="status">
-      <strong>IP:</strong> )rawliteral" + WiFi.localIP().toString() + R"rawliteral( | <strong>UDP Port:</strong> 4210
-    </div>
-    <form action="/save" method="POST">
-      <div class="card">
-        <h3>&#128348; Clock Settings</h3>
-        
-        <label for="clockStyle">Idle Clock Style</label>
-        <select name="clockStyle" id="clockStyle">
-          <option value="0" )rawliteral" + String(settings.clockStyle == 0 ? "selected" : "") + R"rawliteral(>Mario Animation</option>
-          <option value="1" )rawliteral" + String(settings.clockStyle == 1 ? "selected" : "") + R"rawliteral(>Standard Clock</option>
-          <option value="2" )rawliteral" + String(settings.clockStyle == 2 ? "selected" : "") + R"rawliteral(>Large Clock</option>
-        </select>
-        
-        <label for="use24Hour">Time Format</label>
-        <select name="use24Hour" id="use24Hour">
-          <option value="1" )rawliteral" + String(settings.use24Hour ? "selected" : "") + R"rawliteral(>24-Hour (14:30)</option>
-          <option value="0" )rawliteral" + String(!settings.use24Hour ? "selected" : "") + R"rawliteral(>12-Hour (2:30 PM)</option>
-        </select>
-        
-        <label for="dateFormat">Date Format</label>
-        <select name="dateFormat" id="dateFormat">
-          <option value="0" )rawliteral" + String(settings.dateFormat == 0 ? "selected" : "") + R"rawliteral(>DD/MM/YYYY</option>
-          <option value="1" )rawliteral" + String(settings.dateFormat == 1 ? "selected" : "") + R"rawliteral(>MM/DD/YYYY</option>
-          <option value="2" )rawliteral" + String(settings.dateFormat == 2 ? "selected" : "") + R"rawliteral(>YYYY-MM-DD</option>
-        </select>
-      </div>
-      
-      <div class="card">
-        <h3>&#127760; Timezone</h3>
-        
-        <label for="gmtOffset">GMT Offset (hours)</label>
-        <select name="gmtOffset" id="gmtOffset">
-)rawliteral";
+// GET: current settings and display status as JSON, for the page to fill in
+void handleSettings(const HttpRequest& req, HttpResponse& res) {
+  (void)req;
+  const Settings& s = web_settings;
+  char* body = res.buffer();
+  size_t size = res.capacity();
+  size_t len = appendf(body, size, 0,
+                       "{\"clockStyle\":%d,\"use24Hour\":%d,\"dateFormat\":%d,"
+                       "\"gmtOffset\":%d,\"dst\":%d,\"statsStyle\":%d,",
+                       s.clockStyle, s.use24Hour ? 1 : 0, s.dateFormat,
+                       s.gmtOffset, s.daylightSaving ? 1 : 0, s.statsStyle);
+  len = appendJsonString(body, size, len, "fanLabel", s.fanLabel);
+  len = appendJsonString(body, size, len, "cpuLabel", s.cpuLabel);
+  len = appendJsonString(body, size, len, "ramLabel", s.ramLabel);
+  len = appendJsonString(body, size, len, "gpuLabel", s.gpuLabel);
+  len = appendJsonString(body, size, len, "diskLabel", s.diskLabel);
+
+  IPAddress ip = WiFi.localIP();
+  len = appendf(body, size, len,
+                "\"ip\":\"%u.%u.%u.%u\",\"udpPort\":%d,\"i2cBytesPerSec\":%lu,"
+                "\"displayFps\":%lu,\"i2cClockKhz\":%lu}",
+                ip[0], ip[1], ip[2], ip[3], UDP_PORT,
+                (unsigned long)displayFlush.bytesPerSecond(),
+                (unsigned long)displayFlush.framesPerSecond(),
+                (unsigned long)(displayFlush.clockHz() / 1000));
+
+  res.header("Cache-Control", "no-store");
+  res.send(200, "application/json", len);
+}
 
-  // Generate timezone options
-  for (int i = -12; i <= 14; i++) {
-    String selected = (settings.gmtOffset == i) ? "selected" : "";
-    String label = "GMT" + String(i >= 0 ? "+" : "") + String(i);
-    html += "<option value=\"" + String(i) + "\" " + selected + ">" + label + "</option>\n";
+// Copy a non-empty label argument into `dest`
+void saveLabelArg(const HttpRequest& req, const char* name, char* dest) {
+  char value[16];
+  if (req.arg(name, value, sizeof(value)) && value[0] != '\0') {
+    strncpy(dest, value, 16);  // Zero-fills the tail, so an unchanged label compares equal
   }
+}
 
-  html += R"rawliteral(
-        </select>
-
-        <label for="dst">Daylight Saving Time</label>
-        <select name="dst" id="dst">
-          <option value="1" )rawliteral" + String(settings.daylightSaving ? "selected" : "") + R"rawliteral(>Enabled (+1 hour)</option>
-          <option value="0" )rawliteral" + String(!settings.daylightSaving ? "selected" : "") + R"rawliteral(>Disabled</option>
-        </select>
-      </div>
-
-      <div class="card">
-        <h3>&#128195; Display Labels</h3>
-        <p style="color: #888; font-size: 14px; margin-top: 0;">Customize labels shown on OLED when PC stats are displayed</p>
-
-        <label for="fanLabel">Fan/Pump Label</label>
-        <input type="text" name="fanLabel" id="fanLabel" value=")rawliteral" + String(settings.fanLabel) + R"rawliteral(" maxlength="15" placeholder="PUMP, FAN, COOLER">
-
-        <label for="cpuLabel">CPU Label</label>
-        <input type="text" name="cpuLabel" id="cpuLabel" value=")rawliteral" + String(settings.cpuLabel) + R"rawliteral(" maxlength="15" placeholder="CPU, PROCESSOR">
-
-        <label for="ramLabel">RAM Label</label>
-        <input type="text" name="ramLabel" id="ramLabel" value=")rawliteral" + String(settings.ramLabel) + R"rawliteral(" maxlength="15" placeholder="RAM, MEMORY">
-
-        <label for="gpuLabel">GPU Label</label>
-        <input type="text" name="gpuLabel" id="gpuLabel" value=")rawliteral" + String(settings.gpuLabel) + R"rawliteral(" maxlength="15" placeholder="GPU, GRAPHICS">
-
-        <label for="diskLabel">Disk Label</label>
-        <input type="text" name="diskLabel" id="diskLabel" value=")rawliteral" + String(settings.diskLabel) + R"rawliteral(" maxlength="15" placeholder="DISK, STORAGE, SSD">
-      </div>
+// Parses into a copy; the renderer never sees a half-written Settings
+void handleSave(const HttpRequest& req, HttpResponse& res) {
+  Settings next = web_settings;
+  next.clockStyle = req.argInt("clockStyle", next.clockStyle);
+  next.gmtOffset = req.argInt("gmtOffset", next.gmtOffset);
+  next.daylightSaving = req.argInt("dst", next.daylightSaving) == 1;
+  next.use24Hour = req.argInt("use24Hour", next.use24Hour) == 1;
+  next.dateFormat = req.argInt("dateFormat", next.dateFormat);
+  next.statsStyle = req.argInt("statsStyle", next.statsStyle);
 
-      <button type="submit" class="save-btn">&#128190; Save Settings</button>
-    </form>
-    
-    <form action="/reset" method="GET" onsubmit="return confirm('Reset WiFi settings? Device will restart in AP mode.');">
-      <button type="submit" class="reset-btn">&#128260; Reset WiFi Settings</button>
-    </form>
-    
-    <div class="info">
-      PC Stats Monitor v2.0<br>
-      Configure Python script with IP shown above
-    </div>
-  </div>
-</body>
-</html>
-)rawliteral";
+  // Save custom labels
+  saveLabelArg(req, "fanLabel", next.fanLabel);
+  saveLabelArg(req, "cpuLabel", next.cpuLabel);
+  saveLabelArg(req, "ramLabel", next.ramLabel);
+  saveLabelArg(req, "gpuLabel", next.gpuLabel);
+  saveLabelArg(req, "diskLabel", next.diskLabel);
+
+  saveSettings(next);
+  {
+    std::lock_guard<std::mutex> lock(settings_mutex);
+    web_settings = next;
+  }
+  
+  // The renderer takes them over, sets the timezone and resets the clock
+  // animation before its next frame
+  settings_changed = true;
+  invalidateFrame();
+  
+  handleSettings(req, res);
+}
 
-  server.send(200, "text/html", html);
+// Replies first; serviceHttp() wipes WiFi and restarts a second later
+void handleReset(const HttpRequest& req, HttpResponse& res) {
+  (void)req;
+  size_t len = appendf(res.buffer(), res.capacity(), 0, "Resetting WiFi settings\n");
+  res.send(200, "text/plain", len);
+  wifi_reset_at = millis() + 1000;
 }
 
-void handleSave() {
-  if (server.hasArg("clockStyle")) {
-    settings.clockStyle = server.arg("clockStyle").toInt();
-  }
-  if (server.hasArg("gmtOffset")) {
-    settings.gmtOffset = server.arg("gmtOffset").toInt();
-  }
-  if (server.hasArg("dst")) {
-    settings.daylightSaving = server.arg("dst").toInt() == 1;
-  }
-  if (server.hasArg("use24Hour")) {
-    settings.use24Hour = server.arg("use24Hour").toInt() == 1;
-  }
-  if (server.hasArg("dateFormat")) {
-    settings.dateFormat = server.arg("dateFormat").toInt();
-  }
+// snprintf() at offset `len`, clamped so a full buffer just truncates
+size_t appendf(char* buf, size_t size, size_t len, const char* fmt, ...) {
+  if (len >= size) return len;
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(buf + len, size - len, fmt, args);
+  va_end(args);
+  if (n < 0) return len;
+  return min(len + n, size - 1);
+}
 
-  // Save custom labels
-  if (server.hasArg("fanLabel")) {
-    String fanLbl = server.arg("fanLabel");
-    if (fanLbl.length() > 0) {
-      strncpy(settings.fanLabel, fanLbl.c_str(), 15);
-      settings.fanLabel[15] = '\0';
-    }
-  }
-  if (server.hasArg("cpuLabel")) {
-    String cpuLbl = server.arg("cpuLabel");
-    if (cpuLbl.length() > 0) {
-      strncpy(settings.cpuLabel, cpuLbl.c_str(), 15);
-      settings.cpuLabel[15] = '\0';
-    }
-  }
-  if (server.hasArg("ramLabel")) {
-    String ramLbl = server.arg("ramLabel");
-    if (ramLbl.length() > 0) {
-      strncpy(settings.ramLabel, ramLbl.c_str(), 15);
-      settings.ramLabel[15] = '\0';
+// Append "key":"value", with the value escaped for JSON
+size_t appendJsonString(char* buf, size_t size, size_t len, const char* key, const char* value) {
+  len = appendf(buf, size, len, "\"%s\":\"", key);
+  for (const char* c = value; *c; c++) {
+    if (*c == '"' || *c == '\\') {
+      len = appendf(buf, size, len, "\\%c", *c);
+    } else if ((uint8_t)*c < 0x20) {
+      len = appendf(buf, size, len, "\\u%04x", *c);
+    } else {
+      len = appendf(buf, size, len, "%c", *c);
     }
   }
-  if (server.hasArg("gpuLabel")) {
-    String gpuLbl = server.arg("gpuLabel");
-    if (gpuLbl.length() > 0) {
-      strncpy(settings.gpuLabel, gpuLbl.c_str(), 15);
-      settings.gpuLabel[15] = '\0';
+  return appendf(buf, size, len, "\",");
+}
+
+// Runs on the HTTP task. StageStats and RateCounter are read through their
+// seqlocks; the counters are single words with one writing task each.
+void handleMetrics(const HttpRequest& req, HttpResponse& res) {
+  (void)req;
+  // Plain-text scrape format; longer than one buffer, so it goes out in parts
+  res.stream(200, "text/plain; version=0.0.4", metricsPart);
+}
+
+// One part of /metrics: a stage, a latency stage, a group of counters or the
+// boot stages. Each fits the 1 KB connection buffer with 10-digit values.
+size_t metricsPart(int part, char* body, size_t cap) {
+  size_t len = 0;
+  uint32_t mhz = ESP.getCpuFreqMHz();
+  unsigned long now = millis();
+  
+  if (part < STAGE_COUNT) {
+    if (part == 0) {
+      len = appendf(body, cap, len,
+                      "# HELP pcmon_stage_us Loop stage duration over the last %u samples\n"
+                      "# TYPE pcmon_stage_us gauge\n", (unsigned)StageStats::SAMPLES);
     }
+    StageStats::Summary sum = stage_stats[part].summarize();
+    const char* name = STAGE_NAMES[part];
+    return appendf(body, cap, len,
+                    "pcmon_stage_us{stage=\"%s\",stat=\"min\"} %lu\n"
+                    "pcmon_stage_us{stage=\"%s\",stat=\"avg\"} %lu\n"
+                    "pcmon_stage_us{stage=\"%s\",stat=\"p99\"} %lu\n"
+                    "pcmon_stage_us{stage=\"%s\",stat=\"max\"} %lu\n"
+                    "pcmon_stage_samples_total{stage=\"%s\"} %lu\n",
+                    name, (unsigned long)(sum.min / mhz),
+                    name, (unsigned long)(sum.avg / mhz),
+                    name, (unsigned long)(sum.p99 / mhz),
+                    name, (unsigned long)(sum.max / mhz),
+                    name, (unsigned long)sum.total);
   }
-  if (server.hasArg("diskLabel")) {
-    String diskLbl = server.arg("diskLabel");
-    if (diskLbl.length() > 0) {
-      strncpy(settings.diskLabel, diskLbl.c_str(), 15);
-      settings.diskLabel[15] = '\0';
+  part -= STAGE_COUNT;
+  
+  if (part < LATENCY_COUNT) {
+    if (part == 0) {
+      len = appendf(body, cap, len,
+                      "# HELP pcmon_latency_us Packet latency over the last %u packets\n"
+                      "# TYPE pcmon_latency_us gauge\n", (unsigned)StageStats::SAMPLES);
     }
+    StageStats::Summary sum = latency_stats[part].summarize();
+    const char* name = LATENCY_NAMES[part];
+    return appendf(body, cap, len,
+                    "pcmon_latency_us{stage=\"%s\",stat=\"min\"} %lu\n"
+                    "pcmon_latency_us{stage=\"%s\",stat=\"p50\"} %lu\n"
+                    "pcmon_latency_us{stage=\"%s\",stat=\"p99\"} %lu\n"
+                    "pcmon_latency_us{stage=\"%s\",stat=\"max\"} %lu\n"
+                    "pcmon_latency_samples_total{stage=\"%s\"} %lu\n",
+                    name, (unsigned long)sum.min, name, (unsigned long)sum.p50,
+                    name, (unsigned long)sum.p99, name, (unsigned long)sum.max,
+                    name, (unsigned long)sum.total);
   }
-
-  saveSettings();
-  applyTimezone();
+  part -= LATENCY_COUNT;
   
-  // Reset Mario animation state when switching modes
-  mario_state = MARIO_IDLE;
-  mario_x = -15;
-  animation_triggered = false;
-  time_overridden = false;
-  last_minute = -1;
-  
-  String html = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-  <meta http-equiv="refresh" content="2;url=/">
-  <title>Settings Saved</title>
-  <style>
-    body { font-family: Arial; background: #1a1a2e; color: #00d4ff; display: flex; justify-content: center; align-items: center; height: 100vh; margin: 0; }
-    .msg { text-align: center; }
-    h1 { font-size: 48px; }
-  </style>
-</head>
-<body>
-  <div class="msg">
-    <h1>&#9989;</h1>
-    <p>Settings saved! Redirecting...</p>
-  </div>
-</body>
-</html>
-)rawliteral";
-  
-  server.send(200, "text/html", html);
-}
-
-void handleReset() {
-  String html = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-  <title>Resetting...</title>
-  <style>
-    body { font-family: Arial; background: #1a1a2e; color: #e94560; display: flex; justify-content: center; align-items: center; height: 100vh; margin: 0; }
-    .msg { text-align: center; }
-  </style>
-</head>
-<body>
-  <div class="msg">
-    <h1>&#128260;</h1>
-    <p>Resetting WiFi settings...<br>Connect to "PCMonitor-Setup" to reconfigure.</p>
-  </div>
-</body>
-</html>
-)rawliteral";
-  
-  server.send(200, "text/html", html);
-  delay(1000);
-  
-  wifiManager.resetSettings();
-  ESP.restart();
+  switch (part) {
+    case 0:
+      return appendf(body, cap, len,
+                      "# TYPE pcmon_packets_received_total counter\n"
+                      "pcmon_packets_received_total %lu\n"
+                      "# TYPE pcmon_packets_dropped_total counter\n"
+                      "pcmon_packets_dropped_total %lu\n"
+                      "# TYPE pcmon_packets_malformed_total counter\n"
+                      "pcmon_packets_malformed_total %lu\n"
+                      "# TYPE pcmon_packets_coalesced_total counter\n"
+                      "pcmon_packets_coalesced_total %lu\n"
+                      "# TYPE pcmon_packets_stale_total counter\n"
+                      "pcmon_packets_stale_total %lu\n"
+                      "# TYPE pcmon_packets_reordered_total counter\n"
+                      "pcmon_packets_reordered_total %lu\n"
+                      "# TYPE pcmon_packets_delta_total counter\n"
+                      "pcmon_packets_delta_total %lu\n"
+                      "# TYPE pcmon_keyframe_requests_total counter\n"
+                      "pcmon_keyframe_requests_total %lu\n",
+                      packets_received, packets_dropped, packets_malformed,
+                      packets_coalesced, packets_stale, packets_reordered, packets_delta,
+                      keyframe_requests);
+    case 1:
+      return appendf(body, cap, len,
+                      "# TYPE pcmon_hosts_online gauge\n"
+                      "pcmon_hosts_online %d\n"
+                      "# TYPE pcmon_frames_per_second gauge\n"
+                      "pcmon_frames_per_second %lu\n"
+                      "# TYPE pcmon_display_i2c_bytes_per_second gauge\n"
+                      "pcmon_display_i2c_bytes_per_second %lu\n"
+                      "# TYPE pcmon_display_frames_per_second gauge\n"
+                      "pcmon_display_frames_per_second %lu\n"
+                      "# TYPE pcmon_display_i2c_clock_hz gauge\n"
+                      "pcmon_display_i2c_clock_hz %lu\n"
+                      "# TYPE pcmon_http_connections gauge\n"
+                      "pcmon_http_connections %u\n"
+                      "# TYPE pcmon_http_requests_total counter\n"
+                      "pcmon_http_requests_total %lu\n"
+                      "# TYPE pcmon_http_rejected_total counter\n"
+                      "pcmon_http_rejected_total %lu\n"
+                      "# TYPE pcmon_http_timeouts_total counter\n"
+                      "pcmon_http_timeouts_total %lu\n",
+                      hosts_online,
+                      (unsigned long)frame_rate.perSecond(now),
+                      (unsigned long)displayFlush.bytesPerSecond(),
+                      (unsigned long)displayFlush.framesPerSecond(),
+                      (unsigned long)displayFlush.clockHz(),
+                      (unsigned)server.openConnections(),
+                      (unsigned long)server.totalRequests(),
+                      (unsigned long)server.totalRejected(),
+                      (unsigned long)server.totalTimeouts());
+    case 2:
+      return appendf(body, cap, len,
+                      "# TYPE pcmon_wifi_connected gauge\n"
+                      "pcmon_wifi_connected %d\n"
+                      "# TYPE pcmon_wifi_disconnects_total counter\n"
+                      "pcmon_wifi_disconnects_total %lu\n"
+                      "# TYPE pcmon_wifi_reconnect_attempts_total counter\n"
+                      "pcmon_wifi_reconnect_attempts_total %lu\n"
+                      "# TYPE pcmon_wifi_last_outage_ms gauge\n"
+                      "pcmon_wifi_last_outage_ms %lu\n"
+                      "# TYPE pcmon_free_heap_bytes gauge\n"
+                      "pcmon_free_heap_bytes %lu\n"
+                      "# TYPE pcmon_uptime_seconds counter\n"
+                      "pcmon_uptime_seconds %lu\n",
+                      link_state == LINK_UP ? 1 : 0,
+                      wifi_disconnects, wifi_attempts, wifi_last_outage_ms,
+                      (unsigned long)ESP.getFreeHeap(),
+                      now / 1000);
+    case 3:
+      len = appendf(body, cap, len,
+                      "# HELP pcmon_boot_stage_ms Milliseconds since power-on at each boot stage\n"
+                      "# TYPE pcmon_boot_stage_ms gauge\n");
+      for (int i = 0; i < boot_stage_count; i++) {
+        len = appendf(body, cap, len, "pcmon_boot_stage_ms{stage=\"%s\"} %lu\n",
+                      boot_stages[i].name, boot_stages[i].ms);
+      }
+      return len;
+  }
+  return 0;
 }
 
 void displaySetupInstructions() {
@@ -572,7 +1125,7 @@ void displaySetupInstructions() {
   display.setCursor(0, 50);
   display.println("2.Open 192.168.4.1");
   
-  display.display();
+  displayFlush.flush();
 }
 
 void displayConnecting() {
@@ -582,7 +1135,7 @@ void displayConnecting() {
   display.println("Connecting to");
   display.setCursor(30, 40);
   display.println("WiFi...");
-  display.display();
+  displayFlush.flush();
 }
 
 void displayConnected() {
@@ -607,37 +1160,85 @@ void displayConnected() {
   display.println("Open IP in browser");
   display.setCursor(12, 56);
   display.println("to change settings");
-  
-  display.display();
 }
 
+// Render task: draws a frame when the snapshot changed or a deadline is due
 void loop() {
-  // Handle web server requests
-  server.handleClient();
+#ifdef PCMON_NATIVE
+  // No scheduler on the host build: service the network inline
+  serviceHttp();
+  serviceUdp();
+#endif
   
-  if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("WiFi disconnected, restarting...");
-    ESP.restart();
-  }
+  uint32_t loop_start = ESP.getCycleCount();
+  
+  serviceWifi(millis());
   
-  int packetSize = udp.parsePacket();
-  if (packetSize) {
-    char buffer[512];
-    int len = udp.read(buffer, sizeof(buffer) - 1);
-    if (len > 0) {
-      buffer[len] = '\0';
-      parseStats(buffer);
-      lastReceived = millis();
+  if (stats_snapshot.version() != screen_version) {
+    invalidateFrame();
+  }
+  if (settings_changed.exchange(false)) {
+    {
+      std::lock_guard<std::mutex> lock(settings_mutex);
+      settings = web_settings;
     }
+    applyTimezone();
+    resetClockAnimation();
+    stats_background_valid = false;
+  }
+  
+  unsigned long now = millis();
+  if (!frame_invalid && (long)(next_frame_at - now) > 0) {
+    // Nothing to draw yet: sleep until the next deadline, but wake up
+    // often enough that a new snapshot is still picked up promptly
+    delay(min(next_frame_at - now, NETWORK_POLL_INTERVAL));
+    return;
   }
   
-  stats.online = (millis() - lastReceived) < TIMEOUT;
+  // Renderers pull the deadline in with scheduleFrameIn()
+  frame_invalid = false;
+  next_frame_at = now + IDLE_FRAME_INTERVAL;
+  readSnapshot();
   
-  display.clearDisplay();
+  // Cold-start milestones that happen after setup()
+  if (!boot_stats_shown && screen.online) {
+    boot_stats_shown = true;
+    bootStage("first-stats");
+  }
+  if (!boot_time_synced && time(nullptr) > 1600000000) {
+    boot_time_synced = true;
+    bootStage("ntp");
+  }
+  
+  // Tag the first frame that shows new data from the host already on
+  // screen; the flush hook records when it reached the panel
+  uint32_t frame_tag = 0;
+  if (screen.online) {
+    uint64_t key = ((uint64_t)screen.host_id << 32) | screen.ip;
+    if (key == tagged_host && screen.rx_us != tagged_rx_us) frame_tag = screen.rx_us;
+    tagged_host = key;
+    tagged_rx_us = screen.rx_us;
+  }
+  
+  uint32_t render_start = ESP.getCycleCount();
   
-  if (stats.online) {
-    displayStats();
+  if (!screen.online || settings.statsStyle != 0) {
+    tween_valid = false;  // Stats screen comes back settled, not easing from old values
+  }
+  if (screen.online) {
+    if (settings.statsStyle == 1) {
+      display.clearDisplay();
+      displayHistory();
+    } else if (settings.statsStyle == 2) {
+      displayCores();  // Writes every byte of the frame
+    } else {
+      displayStats();  // Overwrites the whole frame with its background
+    }
+  } else if ((long)(splash_until - now) > 0) {
+    displayConnected();  // IP screen after boot, until stats arrive
+    scheduleFrameIn(splash_until - now);
   } else {
+    display.clearDisplay();
     if (settings.clockStyle == 0) {
       displayClockWithMario();
     } else if (settings.clockStyle == 1) {
@@ -647,117 +1248,788 @@ void loop() {
     }
   }
   
-  display.display();
-  delay(30);
+  uint32_t flush_start = ESP.getCycleCount();
+  displayFlush.flush(frame_tag);
+  uint32_t frame_end = ESP.getCycleCount();
+  
+  stage_stats[STAGE_RENDER].record(flush_start - render_start);
+  stage_stats[STAGE_FLUSH].record(frame_end - flush_start);
+  stage_stats[STAGE_FRAME].record(frame_end - loop_start);
+  frame_rate.tick(millis());
+}
+
+void startNetworkTasks() {
+#ifndef PCMON_NATIVE
+  vTaskPrioritySet(nullptr, RENDER_TASK_PRIORITY);
+  xTaskCreate(udpTask, "udp", UDP_TASK_STACK, nullptr, UDP_TASK_PRIORITY, nullptr);
+  xTaskCreate(httpTask, "http", HTTP_TASK_STACK, nullptr, HTTP_TASK_PRIORITY, nullptr);
+#endif
+}
+
+void udpTask(void* arg) {
+  (void)arg;
+  for (;;) {
+    serviceUdp();
+    delay(NETWORK_POLL_INTERVAL);
+  }
+}
+
+void httpTask(void* arg) {
+  (void)arg;
+  for (;;) {
+    serviceHttp();
+    delay(1);
+  }
+}
+
+void serviceHttp() {
+  if (http_rebind.exchange(false)) {
+    server.end();
+    server.begin();
+  }
+  
+  uint32_t t = ESP.getCycleCount();
+  server.poll(millis());
+  stage_stats[STAGE_HTTP].record(ESP.getCycleCount() - t);
+  
+  if (wifi_reset_at && (long)(millis() - wifi_reset_at) >= 0) {
+    wifiManager.resetSettings();
+    ESP.restart();
+  }
+}
+
+// Receive and parse, then publish a new snapshot if anything on screen
+// may have changed (new packet, host going on/offline, page rotation)
+void serviceUdp() {
+  if (udp_rebind.exchange(false)) {
+    udp.stop();
+    udp.begin(UDP_PORT);
+  }
+  
+  uint32_t t = ESP.getCycleCount();
+  if (receivePackets()) {
+    stage_stats[STAGE_UDP].record(ESP.getCycleCount() - t);
+  }
+  
+  if (updateHostPages(millis()) || hosts_changed) {
+    hosts_changed = false;
+    publishSnapshot();
+  }
+}
+
+void publishSnapshot() {
+  static StatsSnapshot snap;
+  snap.online = shown_host >= 0;
+  snap.hosts_online = hosts_online;
+  snap.page = shown_page;
+  if (snap.online) {
+    const HostStats& host = hosts.at(shown_host);
+    snap.stats = host.stats;
+    snap.history = host.history;
+    snap.ip = host.ip;
+    snap.host_id = host.host_id;
+    snap.rx_us = host.rx_us;
+    snap.cadence_ms = host.cadence_ms;
+  }
+  stats_snapshot.write(snap);
+}
+
+void readSnapshot() {
+  screen_version = stats_snapshot.read(screen);
+}
+
+// Back to a clean Mario state when the clock style or time settings change
+void resetClockAnimation() {
+  mario_state = MARIO_IDLE;
+  mario_x = -15 * FX;
+  animation_triggered = false;
+  time_overridden = false;
+  last_minute = -1;
+}
+
+void invalidateFrame() {
+  frame_invalid = true;
+}
+
+void scheduleFrameIn(unsigned long ms) {
+  unsigned long at = millis() + ms;
+  if ((long)(at - next_frame_at) < 0) {
+    next_frame_at = at;
+  }
+}
+
+// Milliseconds until the wall clock next reaches `second` within a minute
+// (0 = next minute boundary). A few ms of margin make sure the frame lands
+// after the tick, not just before it.
+unsigned long msUntilClockSecond(int second) {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  int now_sec = tv.tv_sec % 60;
+  long ms = ((second - now_sec + 60) % 60) * 1000L - tv.tv_usec / 1000;
+  if (ms <= 0) ms += 60000;
+  return ms + 5;
+}
+
+// Drain the socket, then parse the newest datagram from each sender.
+// Returns true if anything was read.
+bool receivePackets() {
+  static char datagram[UDP_BUFFER_SIZE];
+  unsigned long now = millis();
+  int drained = 0;
+  
+  while (drained < MAX_DRAIN_PER_LOOP) {
+    int packetSize = udp.parsePacket();
+    if (packetSize <= 0) break;
+    uint32_t rx_us = micros();
+    if (rx_us == 0) rx_us = 1;  // 0 means untimed
+    drained++;
+    packets_received++;
+    
+    UdpSource* src = findUdpSource(udp.remoteIP(), udp.remotePort(), now);
+    
+    // Read aside, and take it into the source's slot only if the sequence
+    // number says this is newer; otherwise the slot stays as it is
+    int len = udp.read(datagram, UDP_BUFFER_SIZE - 1);
+    udp.flush();
+    if (len <= 0) continue;
+    datagram[len] = '\0';
+    if (!acceptSequence(src, datagram, len, now)) {
+      packets_stale++;
+      continue;
+    }
+    
+    bool delta = statsIsDelta((const uint8_t*)datagram, len);
+    if (!delta) {
+      src->synced = true;
+    } else if (!src->synced) {
+      // Nothing to apply it to: parsing it would add a host, or a history
+      // sample, built on zeros. Wait for the keyframe.
+      requestKeyframe(src, now);
+      src->last_seen = now;
+      continue;
+    }
+    
+    if (src->pending_len > 0) {
+      if (delta) {
+        parseStats(src->pending, src->pending_len, src->ip, src->pending_rx_us);
+      } else {
+        packets_coalesced++;
+      }
+    }
+    memcpy(src->pending, datagram, len + 1);
+    src->pending_len = len;
+    src->pending_rx_us = rx_us;
+    src->last_seen = now;
+  }
+  
+  for (uint8_t i = 0; i < MAX_HOSTS; i++) {
+    if (!udp_sources.occupied(i)) continue;
+    UdpSource& src = udp_sources.at(i);
+    if (src.pending_len > 0) {
+      parseStats(src.pending, src.pending_len, src.ip, src.pending_rx_us);
+      src.pending_len = 0;
+    }
+  }
+  
+  return drained > 0;
+}
+
+// Slot for this sender, reusing the least recently heard one when full.
+// A datagram still pending in the reused slot is parsed first.
+UdpSource* findUdpSource(uint32_t ip, uint16_t port, unsigned long now) {
+  uint64_t key = ip | ((uint64_t)port << 32);
+  UdpSource* src = udp_sources.obtain(key, now, [](UdpSource& old) {
+    if (old.pending_len > 0) {
+      parseStats(old.pending, old.pending_len, old.ip, old.pending_rx_us);
+    }
+  });
+  src->ip = ip;
+  src->port = port;
+  return src;
+}
+
+// Sequence check: true if this packet should replace what we have. Counts
+// any gap it skips over as dropped, and marks the sender as needing a
+// keyframe. JSON packets without a "seq" key are taken in arrival order.
+bool acceptSequence(UdpSource* src, const char* data, int len, unsigned long now) {
+  uint16_t seq;
+  if (!statsPeekSeq((const uint8_t*)data, len, seq) && !jsonPeekSeq(data, seq)) {
+    return true;
+  }
+  
+  if (src->have_seq && now - src->last_seen < TIMEOUT) {
+    int16_t delta = (int16_t)(seq - src->last_seq);
+    if (delta <= 0 && delta > -SEQ_REORDER_WINDOW) {
+      if (delta < 0) packets_reordered++;
+      return false;  // Duplicate or arrived late
+    }
+    if (delta > 1) {
+      packets_dropped += delta - 1;
+      src->synced = false;
+    }
+  } else {
+    src->synced = false;  // New sender, or back after a silence
+  }
+  
+  src->last_seq = seq;
+  src->have_seq = true;
+  return true;
+}
+
+// Ask the sender for a full packet, at most once per KEYFRAME_REQUEST_INTERVAL
+void requestKeyframe(UdpSource* src, unsigned long now) {
+  if (src->keyframe_requested && now - src->keyframe_requested_at < KEYFRAME_REQUEST_INTERVAL) {
+    return;
+  }
+  uint8_t request[STATS_KEYFRAME_REQUEST_SIZE];
+  size_t len = statsEncodeKeyframeRequest(request, sizeof(request));
+  udp.beginPacket(IPAddress(src->ip), src->port);
+  udp.write(request, len);
+  udp.endPacket();
+  src->keyframe_requested = true;
+  src->keyframe_requested_at = now;
+  keyframe_requests++;
+}
+
+// Top-level "seq": N of a (NUL-terminated) JSON packet, without parsing it
+bool jsonPeekSeq(const char* json, uint16_t& seq) {
+  if (json[0] != '{') return false;
+  const char* p = strstr(json, "\"seq\"");
+  if (!p) return false;
+  p += 5;
+  while (*p == ' ' || *p == ':') p++;
+  if (*p < '0' || *p > '9') return false;
+  seq = (uint16_t)strtoul(p, nullptr, 10);
+  return true;
+}
+
+void parseStats(const char* data, int len, uint32_t ip, uint32_t rx_us) {
+  bool ok;
+  if (statsIsBinary((const uint8_t*)data, len)) {
+    ok = parseBinaryStats((const uint8_t*)data, len, ip, rx_us);
+  } else {
+    // Older senders still send JSON
+    ok = parseJsonStats(data, len, ip, rx_us);
+  }
+  
+  if (ok) {
+    hosts_changed = true;
+    if (rx_us) latency_stats[LATENCY_PARSE].record(micros() - rx_us);
+  } else {
+    packets_malformed++;
+  }
+}
+
+bool parseBinaryStats(const uint8_t* data, int len, uint32_t ip, uint32_t rx_us) {
+  StatsWire pkt;
+  if (!statsWireDecode(data, len, pkt)) {
+    Serial.print("Bad binary packet, len ");
+    Serial.println(len);
+    return false;
+  }
+  
+  // In a keyframe missing fields read as 0, same as a JSON null; a delta
+  // leaves the fields it doesn't carry as they are
+  HostStats& entry = *hostEntry(pkt.host_id, ip);
+  recordArrival(entry, rx_us, pkt.flags & STATS_FLAG_SEND_TIME, pkt.send_ms);
+  PCStats& host = entry.stats;
+  uint16_t p = pkt.present;
+  uint16_t update = STATS_FIELD_ALL;
+  if (pkt.flags & STATS_FLAG_DELTA) {
+    update = p;
+    packets_delta++;
+  }
+  if (update & STATS_FIELD_CPU_PERCENT) {
+    host.cpu_percent = (p & STATS_FIELD_CPU_PERCENT) ? pkt.cpu_percent_x10 * 0.1f : 0;
+  }
+  if (update & STATS_FIELD_RAM_PERCENT) {
+    host.ram_percent = (p & STATS_FIELD_RAM_PERCENT) ? pkt.ram_percent_x10 * 0.1f : 0;
+  }
+  if (update & STATS_FIELD_RAM_USED) {
+    host.ram_used_gb = (p & STATS_FIELD_RAM_USED) ? pkt.ram_used_x10 * 0.1f : 0;
+  }
+  if (update & STATS_FIELD_RAM_TOTAL) {
+    host.ram_total_gb = (p & STATS_FIELD_RAM_TOTAL) ? pkt.ram_total_x10 * 0.1f : 0;
+  }
+  if (update & STATS_FIELD_DISK_PERCENT) {
+    host.disk_percent = (p & STATS_FIELD_DISK_PERCENT) ? pkt.disk_percent_x10 * 0.1f : 0;
+  }
+  if (update & STATS_FIELD_CPU_TEMP) host.cpu_temp = (p & STATS_FIELD_CPU_TEMP) ? pkt.cpu_temp : 0;
+  if (update & STATS_FIELD_GPU_TEMP) host.gpu_temp = (p & STATS_FIELD_GPU_TEMP) ? pkt.gpu_temp : 0;
+  if (update & STATS_FIELD_FAN_SPEED) host.fan_speed = (p & STATS_FIELD_FAN_SPEED) ? pkt.fan_speed : 0;
+  if (pkt.flags & STATS_FLAG_CORES) {
+    host.core_count = pkt.core_count;
+    memcpy(host.cores, pkt.cores, pkt.core_count);
+  } else if (!(pkt.flags & STATS_FLAG_DELTA)) {
+    host.core_count = 0;
+  }
+  
+  if ((p & STATS_FIELD_TIMESTAMP) && pkt.hour < 24 && pkt.minute < 60) {
+    host.timestamp[0] = '0' + pkt.hour / 10;
+    host.timestamp[1] = '0' + pkt.hour % 10;
+    host.timestamp[2] = ':';
+    host.timestamp[3] = '0' + pkt.minute / 10;
+    host.timestamp[4] = '0' + pkt.minute % 10;
+    host.timestamp[5] = '\0';
+  }
+  
+  recordHistory(entry);
+  return true;
 }
 
-void parseStats(const char* json) {
+bool parseJsonStats(const char* json, int len, uint32_t ip, uint32_t rx_us) {
   JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, json);
+  DeserializationError error = deserializeJson(doc, json, len);
   
   if (error) {
     Serial.print("JSON parse error: ");
     Serial.println(error.c_str());
-    return;
+    return false;
   }
   
-  stats.cpu_percent = doc["cpu_percent"] | 0.0;
-  stats.ram_percent = doc["ram_percent"] | 0.0;
-  stats.ram_used_gb = doc["ram_used_gb"] | 0.0;
-  stats.ram_total_gb = doc["ram_total_gb"] | 0.0;
-  stats.disk_percent = doc["disk_percent"] | 0.0;
-  stats.cpu_temp = doc["cpu_temp"] | 0;
-  stats.gpu_temp = doc["gpu_temp"] | 0;
-  stats.fan_speed = doc["fan_speed"] | 0;
+  HostStats& entry = *hostEntry(doc["host_id"] | 0, ip);
+  JsonVariantConst send_ms = doc["send_ms"];
+  recordArrival(entry, rx_us, send_ms.is<uint32_t>(), send_ms | 0u);
+  PCStats& host = entry.stats;
+  host.cpu_percent = doc["cpu_percent"] | 0.0;
+  host.ram_percent = doc["ram_percent"] | 0.0;
+  host.ram_used_gb = doc["ram_used_gb"] | 0.0;
+  host.ram_total_gb = doc["ram_total_gb"] | 0.0;
+  host.disk_percent = doc["disk_percent"] | 0.0;
+  host.cpu_temp = doc["cpu_temp"] | 0;
+  host.gpu_temp = doc["gpu_temp"] | 0;
+  host.fan_speed = doc["fan_speed"] | 0;
+  
+  host.core_count = 0;
+  JsonArrayConst cores = doc["cpu_cores"].as<JsonArrayConst>();
+  for (JsonVariantConst core : cores) {
+    if (host.core_count == STATS_MAX_CORES) break;
+    host.cores[host.core_count++] = constrain((int)((core | 0.0) * 2 + 0.5), 0, 200);
+  }
   
   const char* ts = doc["timestamp"];
   if (ts) {
-    strncpy(stats.timestamp, ts, 5);
-    stats.timestamp[5] = '\0';
+    strncpy(host.timestamp, ts, 5);
+    host.timestamp[5] = '\0';
+  }
+  
+  recordHistory(entry);
+  return true;
+}
+
+// Table entry for the sending host, marked as just heard from
+HostStats* hostEntry(uint8_t host_id, uint32_t ip) {
+  uint64_t key = host_id ? ((1ULL << 32) | host_id) : ip;
+  unsigned long now = millis();
+  HostStats* host = hosts.obtain(key, now);
+  host->ip = ip;
+  host->host_id = host_id;
+  unsigned long gap = now - host->lastReceived;
+  if (host->lastReceived && gap > 0 && gap < TIMEOUT) {
+    host->cadence_ms = host->cadence_ms ? (host->cadence_ms * 7 + gap) / 8 : gap;
+  }
+  host->lastReceived = now;
+  return host;
+}
+
+// Note when the host's newest data arrived, for the display latency, and
+// if the sender stamped it, how late it was against its fastest packet
+void recordArrival(HostStats& entry, uint32_t rx_us, bool has_send_time, uint32_t send_ms) {
+  if (!rx_us) return;
+  entry.rx_us = rx_us;
+  if (!has_send_time) return;
+  
+  SendClock& sc = entry.send_clock;
+  uint32_t offset = rx_us - send_ms * 1000;  // Both wrap; differences don't care
+  int32_t jump = (int32_t)(offset - sc.min_now);
+  if (!sc.valid || jump > SEND_CLOCK_RESET || jump < -SEND_CLOCK_RESET) {
+    sc.min_now = sc.min_prev = offset;
+    sc.count = 0;
+    sc.valid = true;
+  }
+  if ((int32_t)(offset - sc.min_now) < 0) sc.min_now = offset;
+  uint32_t base = (int32_t)(sc.min_prev - sc.min_now) < 0 ? sc.min_prev : sc.min_now;
+  latency_stats[LATENCY_NETWORK].record(offset - base);
+  
+  if (++sc.count >= SEND_CLOCK_WINDOW) {
+    sc.min_prev = sc.min_now;
+    sc.min_now = offset;
+    sc.count = 0;
+  }
+}
+
+// Flush hook: the first frame showing data that arrived at rx_us is out
+void recordDisplayLatency(uint32_t rx_us) {
+  latency_stats[LATENCY_DISPLAY].record(micros() - rx_us);
+}
+
+void recordHistory(HostStats& entry) {
+  unsigned long now = millis();
+  if (entry.history.cpu_percent.size() > 0 && now - entry.history_at < HISTORY_INTERVAL) return;
+  entry.history_at = now;
+  StatsHistory& history = entry.history;
+  const PCStats& s = entry.stats;
+  history.cpu_percent.push(constrain((int)(s.cpu_percent * 2 + 0.5f), 0, 200));
+  history.ram_percent.push(constrain((int)(s.ram_percent * 2 + 0.5f), 0, 200));
+  history.cpu_temp.push(constrain(s.cpu_temp, -128, 127));
+  history.gpu_temp.push(constrain(s.gpu_temp, -128, 127));
+  history.fan_speed.push(constrain((s.fan_speed + 16) / 32, 0, 255));
+}
+
+// Refresh each host's online flag and pick the page to show, moving on to
+// the next online host every HOST_PAGE_INTERVAL. Returns true if any of
+// that changed.
+bool updateHostPages(unsigned long now) {
+  bool changed = false;
+  int online = 0;
+  bool shown_online = false;
+  for (uint8_t i = 0; i < MAX_HOSTS; i++) {
+    if (!hosts.occupied(i)) continue;
+    HostStats& host = hosts.at(i);
+    bool on = (now - host.lastReceived) < TIMEOUT;
+    if (on != host.stats.online) {
+      host.stats.online = on;
+      changed = true;
+    }
+    if (on) {
+      online++;
+      if (i == shown_host) shown_online = true;
+    }
+  }
+  hosts_online = online;
+  if (online == 0) {
+    shown_host = -1;
+    return changed;
+  }
+  
+  bool rotate = online > 1 && now - host_page_since >= HOST_PAGE_INTERVAL;
+  if (!shown_online || rotate) {
+    int next = shown_host;
+    for (uint8_t n = 0; n < MAX_HOSTS; n++) {
+      next = (next + 1) % MAX_HOSTS;
+      if (hosts.occupied(next) && hosts.at(next).stats.online) break;
+    }
+    if (next != shown_host) {
+      shown_host = next;
+      changed = true;
+    }
+    host_page_since = now;
+  }
+  
+  shown_page = 0;
+  for (int i = 0; i <= shown_host; i++) {
+    if (hosts.occupied(i) && hosts.at(i).stats.online) shown_page++;
   }
+  return changed;
 }
 
 void displayStats() {
+  const PCStats& stats = screen.stats;
+  if (!stats_background_valid) {
+    buildStatsBackground();
+  }
+  memcpy(display.getBuffer(), stats_background, sizeof(stats_background));
   display.setTextSize(1);
+  
+  unsigned long now = millis();
+  updateStatsTweens(now);
+  // All in tenths, like the tweens; whole units only where they're printed
+  int32_t fan_x10 = tweenValue(tweens[TWEEN_FAN], now);
+  int32_t ram_x10 = tweenValue(tweens[TWEEN_RAM], now);
+  int32_t cpu_x10 = tweenValue(tweens[TWEEN_CPU], now);
+  int32_t cpu_temp_x10 = tweenValue(tweens[TWEEN_CPU_TEMP], now);
+  int32_t gpu_temp_x10 = tweenValue(tweens[TWEEN_GPU], now);
+  int32_t disk_x10 = tweenValue(tweens[TWEEN_DISK], now);
+  for (int i = 0; i < TWEEN_COUNT; i++) {
+    if (tweens[i].duration > 0) {
+      scheduleFrameIn(TWEEN_FRAME_INTERVAL);
+      break;
+    }
+  }
 
   // Fan/Pump line
-  display.setCursor(0, 0);
-  display.print(settings.fanLabel);
-  display.print(":");
-  display.print(stats.fan_speed);
+  display.setCursor(stats_value_x[LINE_FAN], stats_value_y[LINE_FAN]);
+  display.print(fan_x10 / 10);
   display.print("RPM");
 
-  display.setCursor(85, 0);
-  display.print(stats.timestamp);
+  if (screen.hosts_online > 1) {
+    // Which host this page belongs to instead of its clock, e.g. ".23 2/3"
+    char tag[24];
+    if (screen.host_id) {
+      snprintf(tag, sizeof(tag), "#%u %d/%d", screen.host_id, screen.page, screen.hosts_online);
+    } else {
+      snprintf(tag, sizeof(tag), ".%lu %d/%d", (unsigned long)(screen.ip >> 24),
+               screen.page, screen.hosts_online);
+    }
+    display.setCursor(SCREEN_WIDTH - strlen(tag) * 6, 0);
+    display.print(tag);
+  } else {
+    display.setCursor(85, 0);
+    display.print(stats.timestamp);
+  }
 
   // RAM line
-  display.setCursor(0, 14);
-  display.print(settings.ramLabel);
-  display.print(": ");
-  display.print((int)stats.ram_percent);
+  display.setCursor(stats_value_x[LINE_RAM], stats_value_y[LINE_RAM]);
+  display.print(ram_x10 / 10);
   display.print("%");
 
-  int ram_bar = (int)(stats.ram_percent * 0.6);
-  display.drawRect(70, 14, 58, 8, SSD1306_WHITE);
+  // Settled bars come from the packet's value: tenths lose the pixel where
+  // percent * 0.6 crosses a whole number between two tenths
+  int ram_bar = tweens[TWEEN_RAM].duration ? ram_x10 * 6 / 100 : (int)(stats.ram_percent * 0.6);
   if (ram_bar > 0) {
     display.fillRect(71, 15, ram_bar, 6, SSD1306_WHITE);
   }
 
   // CPU line
-  display.setCursor(0, 28);
-  display.print(settings.cpuLabel);
-  display.print(": ");
-  display.print((int)stats.cpu_percent);
+  display.setCursor(stats_value_x[LINE_CPU], stats_value_y[LINE_CPU]);
+  display.print(cpu_x10 / 10);
   display.print("% ");
-  display.print(stats.cpu_temp);
+  display.print(cpu_temp_x10 / 10);
   display.print("C");
 
-  int cpu_bar = (int)(stats.cpu_percent * 0.6);
-  display.drawRect(70, 28, 58, 8, SSD1306_WHITE);
+  int cpu_bar = tweens[TWEEN_CPU].duration ? cpu_x10 * 6 / 100 : (int)(stats.cpu_percent * 0.6);
   if (cpu_bar > 0) {
     display.fillRect(71, 29, cpu_bar, 6, SSD1306_WHITE);
   }
 
   // GPU line
-  display.setCursor(0, 42);
-  display.print(settings.gpuLabel);
-  display.print(": ");
-  display.print(stats.gpu_temp);
+  display.setCursor(stats_value_x[LINE_GPU], stats_value_y[LINE_GPU]);
+  display.print(gpu_temp_x10 / 10);
   display.print("C");
 
-  int gpu_bar = map(stats.gpu_temp, 0, 100, 0, 56);
-  gpu_bar = constrain(gpu_bar, 0, 56);
-  display.drawRect(70, 42, 58, 8, SSD1306_WHITE);
+  int gpu_bar = constrain(gpu_temp_x10 * 56 / 1000, 0, 56);
   if (gpu_bar > 0) {
     display.fillRect(71, 43, gpu_bar, 6, SSD1306_WHITE);
   }
 
   // Disk line
-  display.setCursor(0, 56);
-  display.print(settings.diskLabel);
-  display.print(":");
-  display.print((int)stats.disk_percent);
+  display.setCursor(stats_value_x[LINE_DISK], stats_value_y[LINE_DISK]);
+  display.print(disk_x10 / 10);
   display.print("%");
 
-  int disk_bar = (int)(stats.disk_percent * 0.56);
-  display.drawRect(70, 56, 58, 8, SSD1306_WHITE);
+  int disk_bar = tweens[TWEEN_DISK].duration ? disk_x10 * 56 / 1000
+                                               : (int)(stats.disk_percent * 0.56);
   if (disk_bar > 0) {
     display.fillRect(71, 57, disk_bar, 6, SSD1306_WHITE);
   }
 }
 
+// Point each tween at the snapshot's values. A new host on screen starts
+// settled; otherwise a changed value eases over the host's packet interval.
+void updateStatsTweens(unsigned long now) {
+  const PCStats& stats = screen.stats;
+  int32_t targets[TWEEN_COUNT];
+  targets[TWEEN_FAN] = stats.fan_speed * 10;
+  // Truncated like the plain (int) the screen always printed, so a settled
+  // tween shows the same digits
+  targets[TWEEN_RAM] = (int32_t)(stats.ram_percent * 10.0);
+  targets[TWEEN_CPU] = (int32_t)(stats.cpu_percent * 10.0);
+  targets[TWEEN_CPU_TEMP] = stats.cpu_temp * 10;
+  targets[TWEEN_GPU] = stats.gpu_temp * 10;
+  targets[TWEEN_DISK] = (int32_t)(stats.disk_percent * 10.0);
+  
+  uint64_t host = ((uint64_t)screen.host_id << 32) | screen.ip;
+  unsigned long duration = min((unsigned long)screen.cadence_ms, TWEEN_MAX_DURATION);
+  if (!tween_valid || host != tween_host || duration < 2 * TWEEN_FRAME_INTERVAL) {
+    duration = 0;  // Snap
+  }
+  tween_valid = true;
+  tween_host = host;
+  
+  for (int i = 0; i < TWEEN_COUNT; i++) {
+    tweenTo(tweens[i], targets[i], now, duration);
+  }
+}
+
+// Retarget from wherever the tween is now, so a packet arriving mid-way
+// bends the motion instead of restarting it
+void tweenTo(Tween& t, int32_t target, unsigned long now, unsigned long duration) {
+  if (target == t.to && duration > 0) return;
+  t.from = duration ? tweenValue(t, now) : target;
+  t.to = target;
+  t.start = now;
+  t.duration = t.from == target ? 0 : duration;
+}
+
+// Value at `now`, easing out (fast start, gentle stop); settles the tween
+// once it reaches the end
+int32_t tweenValue(Tween& t, unsigned long now) {
+  if (t.duration == 0) return t.to;
+  unsigned long elapsed = now - t.start;
+  if (elapsed >= t.duration) {
+    t.duration = 0;
+    return t.to;
+  }
+  int32_t p = (int32_t)(elapsed * TWEEN_ONE / t.duration);
+  int32_t eased = p * (2 * TWEEN_ONE - p) / TWEEN_ONE;  // 1 - (1 - p)^2
+  return t.from + (int32_t)((int64_t)(t.to - t.from) * eased / TWEEN_ONE);
+}
+
+// Draw the labels and bar frames of the stats screen into the framebuffer
+// and keep a copy, noting where each line's value continues
+void buildStatsBackground() {
+  const char* labels[LINE_COUNT] = {settings.fanLabel, settings.ramLabel, settings.cpuLabel,
+                                    settings.gpuLabel, settings.diskLabel};
+  const char* separators[LINE_COUNT] = {":", ": ", ": ", ": ", ":"};
+  
+  display.clearDisplay();
+  display.setTextSize(1);
+  for (int i = 0; i < LINE_COUNT; i++) {
+    display.setCursor(0, i == LINE_FAN ? 0 : i * 14);
+    display.print(labels[i]);
+    display.print(separators[i]);
+    stats_value_x[i] = display.getCursorX();
+    stats_value_y[i] = display.getCursorY();
+  }
+  
+  display.drawRect(70, 14, 58, 8, SSD1306_WHITE);
+  display.drawRect(70, 28, 58, 8, SSD1306_WHITE);
+  display.drawRect(70, 42, 58, 8, SSD1306_WHITE);
+  display.drawRect(70, 56, 58, 8, SSD1306_WHITE);
+  
+  memcpy(stats_background, display.getBuffer(), sizeof(stats_background));
+  stats_background_valid = true;
+}
+
+// ========== History Graph Display ==========
+// Sparkline of `hist` scaled lo..hi into a band `h` px tall at `y`, newest
+// sample at the right edge. Consecutive samples are joined by a vertical
+// run so steep changes stay visible.
+template <typename T>
+void drawSparkline(const MetricHistory<T>& hist, int y, int h, int lo, int hi) {
+  uint16_t n = hist.size();
+  if (n == 0 || hi <= lo) return;
+  
+  int x = SCREEN_WIDTH - n;
+  int prev = -1;
+  for (uint16_t i = 0; i < n; i++, x++) {
+    int v = constrain((int)hist[i], lo, hi);
+    int py = y + h - 1 - (v - lo) * (h - 1) / (hi - lo);
+    if (prev < 0) prev = py;
+    int top = min(prev, py);
+    display.drawFastVLine(x, top, max(prev, py) - top + 1, SSD1306_WHITE);
+    prev = py;
+  }
+}
+
+// One 12 px band per metric with its label and current value on top.
+// Temperatures and fan speed scale to the highest sample in the window.
+void displayHistory() {
+  const PCStats& stats = screen.stats;
+  const StatsHistory& h = screen.history;
+  const int BAND = 12;
+  
+  drawSparkline(h.cpu_percent, 0, BAND, 0, 200);
+  drawSparkline(h.ram_percent, 13, BAND, 0, 200);
+  drawSparkline(h.cpu_temp, 26, BAND, 20, max((int)h.cpu_temp.max(), 60));
+  drawSparkline(h.gpu_temp, 39, BAND, 20, max((int)h.gpu_temp.max(), 60));
+  drawSparkline(h.fan_speed, 52, BAND, 0, max((int)h.fan_speed.max(), 1));
+  
+  // Labels get a black background so the graph doesn't run through them
+  display.setTextSize(1);
+  display.setTextColor(SSD1306_WHITE, SSD1306_BLACK);
+  
+  display.setCursor(0, 0);
+  display.print(settings.cpuLabel);
+  display.print(" ");
+  display.print((int)stats.cpu_percent);
+  display.print("%");
+  
+  display.setCursor(0, 13);
+  display.print(settings.ramLabel);
+  display.print(" ");
+  display.print((int)stats.ram_percent);
+  display.print("%");
+  
+  display.setCursor(0, 26);
+  display.print(settings.cpuLabel);
+  display.print(" ");
+  display.print(stats.cpu_temp);
+  display.print("C");
+  
+  display.setCursor(0, 39);
+  display.print(settings.gpuLabel);
+  display.print(" ");
+  display.print(stats.gpu_temp);
+  display.print("C");
+  
+  display.setCursor(0, 52);
+  display.print(settings.fanLabel);
+  display.print(" ");
+  display.print(stats.fan_speed);
+  
+  display.setTextColor(SSD1306_WHITE);
+}
+
+// ========== Per-Core Display ==========
+// One vertical bar per core across the full width, so a single pegged
+// thread stands out on a 32-core machine. The bars are written straight
+// into the framebuffer, a whole byte (8 rows) at a time, column by column:
+// one pass over the frame with no per-pixel calls. Page 0 holds the
+// core count, average and busiest core.
+const int CORES_TOP_PAGE = 1;
+const int CORES_BAR_HEIGHT = SCREEN_HEIGHT - CORES_TOP_PAGE * 8;  // 56 px
+
+void displayCores() {
+  const PCStats& stats = screen.stats;
+  int n = stats.core_count;
+  if (n == 0) {
+    display.clearDisplay();
+    display.setTextSize(1);
+    display.setCursor(0, 20);
+    display.println("No per-core data");
+    display.println("Run the sender with");
+    display.println("--cores");
+    return;
+  }
+  
+  int width = SCREEN_WIDTH / n;           // 2 px per core at 64 cores
+  int left = (SCREEN_WIDTH - width * n) / 2;
+  int bar = width >= 2 ? width - 1 : 1;   // 1 px gap between cores if there's room
+  int sum = 0;
+  int peak = 0;
+  uint8_t* buf = display.getBuffer();
+  for (int x = 0; x < SCREEN_WIDTH; x++) {
+    int top = SCREEN_HEIGHT;  // First lit row; SCREEN_HEIGHT = empty column
+    int col = x - left;
+    if (col >= 0 && col < width * n && col % width < bar) {
+      int load = stats.cores[col / width];
+      top -= (load * CORES_BAR_HEIGHT + 100) / 200;
+    }
+    buf[x] = 0;
+    for (int page = CORES_TOP_PAGE; page < SCREEN_HEIGHT / 8; page++) {
+      int shift = top - page * 8;
+      buf[page * SCREEN_WIDTH + x] = shift <= 0 ? 0xFF : shift >= 8 ? 0 : (uint8_t)(0xFF << shift);
+    }
+  }
+  for (int i = 0; i < n; i++) {
+    sum += stats.cores[i];
+    peak = max(peak, (int)stats.cores[i]);
+  }
+  
+  // e.g. "16c avg 23% max 100%"
+  display.setTextSize(1);
+  display.setCursor(0, 0);
+  display.print(n);
+  display.print("c avg ");
+  display.print((sum / n + 1) / 2);
+  display.print("% max ");
+  display.print((peak + 1) / 2);
+  display.print("%");
+}
+
 // ========== Standard Clock Display ==========
 void displayStandardClock() {
   struct tm timeinfo;
-  if(!getLocalTime(&timeinfo)) {
+  if(!getLocalTime(&timeinfo, 0)) {  // Not synced yet; SNTP runs in the background
     display.setTextSize(1);
     display.setCursor(20, 28);
-    display.print("Time Error");
+    display.print("Syncing time...");
+    scheduleFrameIn(1000);
     return;
   }
   
   // Time display
-  display.setTextSize(3);
   char timeStr[9];
   
   int displayHour = timeinfo.tm_hour;
@@ -774,8 +2046,7 @@ void displayStandardClock() {
   // Center time
   int time_width = 5 * 18;  // 5 chars * 18px
   int time_x = (SCREEN_WIDTH - time_width) / 2;
-  display.setCursor(time_x, 8);
-  display.print(timeStr);
+  blitBigString(display, BIG_DIGITS_3, timeStr, time_x, 8);
   
   // AM/PM indicator for 12-hour format
   if (!settings.use24Hour) {
@@ -811,15 +2082,19 @@ void displayStandardClock() {
   int day_x = (SCREEN_WIDTH - day_width) / 2;
   display.setCursor(day_x, 52);
   display.print(dayName);
+  
+  // Nothing on this screen changes before the next minute
+  scheduleFrameIn(msUntilClockSecond(0));
 }
 
 // ========== Large Clock Display ==========
 void displayLargeClock() {
   struct tm timeinfo;
-  if(!getLocalTime(&timeinfo)) {
+  if(!getLocalTime(&timeinfo, 0)) {  // Not synced yet; SNTP runs in the background
     display.setTextSize(1);
     display.setCursor(20, 28);
-    display.print("Time Error");
+    display.print("Syncing time...");
+    scheduleFrameIn(1000);
     return;
   }
   
@@ -833,14 +2108,12 @@ void displayLargeClock() {
   }
   
   // Large time display - size 4 (24px per char)
-  display.setTextSize(4);
   char timeStr[6];
   sprintf(timeStr, "%02d:%02d", displayHour, timeinfo.tm_min);
   
   // Center time: 5 chars * 24px = 120px, centered in 128px
   int time_x = (SCREEN_WIDTH - 120) / 2;
-  display.setCursor(time_x, 4);
-  display.print(timeStr);
+  blitBigString(display, BIG_DIGITS_4, timeStr, time_x, 4);
   
   // AM/PM indicator for 12-hour format
   if (!settings.use24Hour) {
@@ -868,6 +2141,8 @@ void displayLargeClock() {
   int date_x = (SCREEN_WIDTH - 60) / 2;
   display.setCursor(date_x, 54);
   display.print(dateStr);
+  
+  scheduleFrameIn(msUntilClockSecond(0));
 }
 
 // ========== Mario Clock Functions ==========
@@ -878,6 +2153,29 @@ void triggerDigitBounce(int digitIndex) {
 }
 
 void updateDigitBounce() {
+  unsigned long currentMillis = millis();
+  
+  // At rest the timestep restarts, so a bounce triggered later in this
+  // frame takes its first step DIGIT_BOUNCE_SPEED from now
+  if (!digitsBouncing()) {
+    last_bounce_update = currentMillis;
+    return;
+  }
+  
+  unsigned long steps = (currentMillis - last_bounce_update) / DIGIT_BOUNCE_SPEED;
+  if (steps > MAX_CATCHUP_STEPS) {
+    steps = 1;
+    last_bounce_update = currentMillis;
+  } else {
+    last_bounce_update += steps * DIGIT_BOUNCE_SPEED;
+  }
+  
+  while (steps--) {
+    digitBounceStep();
+  }
+}
+
+void digitBounceStep() {
   for (int i = 0; i < 5; i++) {
     if (digit_offset_y[i] != 0 || digit_velocity[i] != 0) {
       digit_velocity[i] += DIGIT_GRAVITY;
@@ -891,9 +2189,14 @@ void updateDigitBounce() {
   }
 }
 
+bool digitsBouncing() {
+  for (int i = 0; i < 5; i++) {
+    if (digit_offset_y[i] != 0 || digit_velocity[i] != 0) return true;
+  }
+  return false;
+}
+
 void drawTimeWithBounce() {
-  display.setTextSize(3);
-  
   char digits[5];
   digits[0] = '0' + (displayed_hour / 10);
   digits[1] = '0' + (displayed_hour % 10);
@@ -902,18 +2205,18 @@ void drawTimeWithBounce() {
   digits[4] = '0' + (displayed_min % 10);
   
   for (int i = 0; i < 5; i++) {
-    int y = TIME_Y + (int)digit_offset_y[i];
-    display.setCursor(DIGIT_X[i], y);
-    display.print(digits[i]);
+    int y = TIME_Y + digit_offset_y[i] / FX;
+    blitBigGlyph(display, BIG_DIGITS_3, digits[i], DIGIT_X[i], y);
   }
 }
 
 void displayClockWithMario() {
   struct tm timeinfo;
-  if(!getLocalTime(&timeinfo)) {
+  if(!getLocalTime(&timeinfo, 0)) {  // Not synced yet; SNTP runs in the background
     display.setTextSize(1);
     display.setCursor(20, 28);
-    display.print("Time Error");
+    display.print("Syncing time...");
+    scheduleFrameIn(1000);
     return;
   }
   
@@ -951,9 +2254,26 @@ void displayClockWithMario() {
   
   updateMarioAnimation(&timeinfo);
   
-  int mario_draw_y = mario_base_y + (int)mario_jump_y;
+  int mario_draw_y = mario_base_y + mario_jump_y / FX;
   bool isJumping = (mario_state == MARIO_JUMPING);
-  drawMario((int)mario_x, mario_draw_y, mario_facing_right, mario_walk_frame, isJumping);
+  drawMario(mario_x / FX, mario_draw_y, mario_facing_right, mario_walk_frame, isJumping);
+  
+  // While Mario or a digit is moving, come back for the next animation
+  // step; otherwise sleep until he is due to start (second 55) or the
+  // minute rolls over, whichever is first
+  bool bouncing = digitsBouncing();
+  
+  unsigned long now = millis();
+  if (mario_state != MARIO_IDLE) {
+    scheduleFrameIn(MARIO_ANIM_SPEED - min(now - last_mario_update, (unsigned long)MARIO_ANIM_SPEED));
+  } else if (!animation_triggered && timeinfo.tm_sec >= 55) {
+    scheduleFrameIn(MARIO_ANIM_SPEED);
+  } else {
+    scheduleFrameIn(msUntilClockSecond(animation_triggered ? 0 : 55));
+  }
+  if (bouncing) {
+    scheduleFrameIn(DIGIT_BOUNCE_SPEED - min(now - last_bounce_update, (unsigned long)DIGIT_BOUNCE_SPEED));
+  }
 }
 
 void advanceDisplayedTime() {
@@ -1038,8 +2358,23 @@ void updateMarioAnimation(struct tm* timeinfo) {
   if (currentMillis - last_mario_update < MARIO_ANIM_SPEED) {
     return;
   }
-  last_mario_update = currentMillis;
   
+  // Idle steps only check whether to start, so there is nothing to catch
+  // up on: restart the timestep from now, as after a long stall
+  unsigned long steps = (currentMillis - last_mario_update) / MARIO_ANIM_SPEED;
+  if (mario_state == MARIO_IDLE || steps > MAX_CATCHUP_STEPS) {
+    steps = 1;
+    last_mario_update = currentMillis;
+  } else {
+    last_mario_update += steps * MARIO_ANIM_SPEED;
+  }
+  
+  while (steps--) {
+    marioStep(timeinfo);
+  }
+}
+
+void marioStep(struct tm* timeinfo) {
   int seconds = timeinfo->tm_sec;
   int current_minute = timeinfo->tm_min;
   
@@ -1053,7 +2388,7 @@ void updateMarioAnimation(struct tm* timeinfo) {
     calculateTargetDigits(displayed_hour, displayed_min);
     if (num_targets > 0) {
       current_target_index = 0;
-      mario_x = -15;
+      mario_x = -15 * FX;
       mario_state = MARIO_WALKING;
       mario_facing_right = true;
       digit_bounce_triggered = false;
@@ -1063,19 +2398,19 @@ void updateMarioAnimation(struct tm* timeinfo) {
   switch (mario_state) {
     case MARIO_IDLE:
       mario_walk_frame = 0;
-      mario_x = -15;
+      mario_x = -15 * FX;
       break;
       
     case MARIO_WALKING:
       if (current_target_index < num_targets) {
-        int target = target_x_positions[current_target_index];
+        int target = target_x_positions[current_target_index] * FX;
         
-        if (abs(mario_x - target) > 3) {
+        if (abs(mario_x - target) > 3 * FX) {
           if (mario_x < target) {
-            mario_x += 2.5;
+            mario_x += MARIO_WALK_SPEED;
             mario_facing_right = true;
           } else {
-            mario_x -= 2.5;
+            mario_x -= MARIO_WALK_SPEED;
             mario_facing_right = false;
           }
           mario_walk_frame = (mario_walk_frame + 1) % 2;
@@ -1097,7 +2432,7 @@ void updateMarioAnimation(struct tm* timeinfo) {
         jump_velocity += GRAVITY;
         mario_jump_y += jump_velocity;
 
-        int mario_head_y = mario_base_y + (int)mario_jump_y - MARIO_HEAD_OFFSET;
+        int mario_head_y = mario_base_y + mario_jump_y / FX - MARIO_HEAD_OFFSET;
 
         if (!digit_bounce_triggered && mario_head_y <= DIGIT_BOTTOM) {
           digit_bounce_triggered = true;
@@ -1107,7 +2442,7 @@ void updateMarioAnimation(struct tm* timeinfo) {
           updateSpecificDigit(target_digit_index[current_target_index],
                              target_digit_values[current_target_index]);
 
-          jump_velocity = 2.0;
+          jump_velocity = HIT_REBOUND;
         }
 
         if (mario_jump_y >= 0) {
@@ -1118,7 +2453,7 @@ void updateMarioAnimation(struct tm* timeinfo) {
 
           if (current_target_index < num_targets) {
             mario_state = MARIO_WALKING;
-            mario_facing_right = (target_x_positions[current_target_index] > mario_x);
+            mario_facing_right = (target_x_positions[current_target_index] * FX > mario_x);
             digit_bounce_triggered = false;
           } else {
             mario_state = MARIO_WALKING_OFF;
@@ -1129,56 +2464,25 @@ void updateMarioAnimation(struct tm* timeinfo) {
       break;
       
     case MARIO_WALKING_OFF:
-      mario_x += 2.5;
+      mario_x += MARIO_WALK_SPEED;
       mario_walk_frame = (mario_walk_frame + 1) % 2;
       
-      if (mario_x > SCREEN_WIDTH + 15) {
+      if (mario_x > (SCREEN_WIDTH + 15) * FX) {
         mario_state = MARIO_IDLE;
-        mario_x = -15;
+        mario_x = -15 * FX;
       }
       break;
   }
 }
 
 void drawMario(int x, int y, bool facingRight, int frame, bool jumping) {
-  if (x < -10 || x > SCREEN_WIDTH + 10) return;
-  
-  int sx = x - 4;
-  int sy = y - 10;
-  
+  const MarioSprite* sprite;
   if (jumping) {
-    display.fillRect(sx + 2, sy, 4, 3, SSD1306_WHITE);
-    display.fillRect(sx + 2, sy + 3, 4, 3, SSD1306_WHITE);
-    display.drawPixel(sx + 1, sy + 2, SSD1306_WHITE);
-    display.drawPixel(sx + 6, sy + 2, SSD1306_WHITE);
-    display.drawPixel(sx + 0, sy + 1, SSD1306_WHITE);
-    display.drawPixel(sx + 7, sy + 1, SSD1306_WHITE);
-    display.fillRect(sx + 2, sy + 6, 2, 3, SSD1306_WHITE);
-    display.fillRect(sx + 4, sy + 6, 2, 3, SSD1306_WHITE);
+    sprite = &MARIO_JUMP;
+  } else if (facingRight) {
+    sprite = &MARIO_WALK_RIGHT[frame % 2];
   } else {
-    display.fillRect(sx + 2, sy, 4, 3, SSD1306_WHITE);
-    if (facingRight) {
-      display.drawPixel(sx + 6, sy + 1, SSD1306_WHITE);
-    } else {
-      display.drawPixel(sx + 1, sy + 1, SSD1306_WHITE);
-    }
-    
-    display.fillRect(sx + 2, sy + 3, 4, 3, SSD1306_WHITE);
-    
-    if (facingRight) {
-      display.drawPixel(sx + 1, sy + 4, SSD1306_WHITE);
-      display.drawPixel(sx + 6, sy + 3 + (frame % 2), SSD1306_WHITE);
-    } else {
-      display.drawPixel(sx + 6, sy + 4, SSD1306_WHITE);
-      display.drawPixel(sx + 1, sy + 3 + (frame % 2), SSD1306_WHITE);
-    }
-    
-    if (frame == 0) {
-      display.fillRect(sx + 2, sy + 6, 2, 3, SSD1306_WHITE);
-      display.fillRect(sx + 4, sy + 6, 2, 3, SSD1306_WHITE);
-    } else {
-      display.fillRect(sx + 1, sy + 6, 2, 3, SSD1306_WHITE);
-      display.fillRect(sx + 5, sy + 6, 2, 3, SSD1306_WHITE);
-    }
+    sprite = &MARIO_WALK_LEFT[frame % 2];
   }
+  blitSprite(display, *sprite, x - 4, y - 10);
 }
\ No newline at end of file
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""
+Generate include/WebAssets.h from the files in web/.
+
+Each asset is gzipped (level 9, fixed mtime so the output is reproducible)
+and emitted as a byte array in flash, next to an uncompressed copy for
+clients that don't accept gzip. Each copy gets an ETag derived from its
+bytes. Re-run after editing anything in web/:
+
+    python3 tools/embed_web.py
+"""
+
+import gzip
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUTPUT = os.path.join(ROOT, "include", "WebAssets.h")
+
+# (file in web/, URL path, content type)
+ASSETS = [
+    ("index.html", "/", "text/html"),
+]
+
+
+def fnv1a(data):
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def symbol(name):
+    return "WEB_" + "".join(c if c.isalnum() else "_" for c in name).upper()
+
+
+def byte_array(out, sym, data):
+    out.append("const uint8_t %s[] PROGMEM = {" % sym)
+    for i in range(0, len(data), 16):
+        out.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    out.append("};")
+
+
+def main():
+    out = [
+        "/*",
+        " * WebAssets - web UI, gzipped and plain, generated by tools/embed_web.py from web/",
+        " *",
+        " * Do not edit; change the files in web/ and re-run the script.",
+        " */",
+        "",
+        "#ifndef WEB_ASSETS_H",
+        "#define WEB_ASSETS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "struct WebAsset {",
+        "  const char* path;",
+        "  const char* type;",
+        "  const uint8_t* data;  // gzip",
+        "  size_t len;",
+        "  const char* etag;",
+        "  const uint8_t* raw;   // Uncompressed, for clients without gzip",
+        "  size_t raw_len;",
+        "  const char* raw_etag;",
+        "};",
+        "",
+    ]
+    table = []
+    for name, path, ctype in ASSETS:
+        with open(os.path.join(ROOT, "web", name), "rb") as f:
+            raw = f.read()
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        sym = symbol(name)
+        out.append("// %s: %d bytes, %d gzipped" % (name, len(raw), len(gz)))
+        byte_array(out, sym + "_GZ", gz)
+        byte_array(out, sym, raw)
+        out.append("")
+        table.append('  {"%s", "%s", %s_GZ, sizeof(%s_GZ), "\\"%08x\\"",'
+                     % (path, ctype, sym, sym, fnv1a(gz)))
+        table.append('   %s, sizeof(%s), "\\"%08x\\""},' % (sym, sym, fnv1a(raw)))
+        print("%-12s %6d -> %5d bytes" % (name, len(raw), len(gz)))
+
+    out.append("const WebAsset WEB_ASSETS[] = {")
+    out.extend(table)
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(out) + "\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""
+Fake stats sender for checking the monitor's latency and loss accounting.
+
+Sends binary packets with a sequence number and send time at a fixed
+rate, leaving out every --drop-every'th one and holding every
+--reorder-every'th back until after the next, then reads /metrics and
+compares the dropped/reordered counters with what was done and prints the
+latency percentiles the display measured. Stop the real senders first:
+the counters cover every sender.
+
+    python3 tools/fake_sender.py 192.168.0.19 --packets 400 --interval 0.05
+"""
+
+import argparse
+import re
+import socket
+import struct
+import time
+
+UDP_PORT = 4210
+PACKET_FORMAT = struct.Struct("<HBBHHHHHHHbbHBB")
+PACKET_MAGIC = 0x4D50
+PACKET_VERSION = 1
+FLAG_SEND_TIME = 0x02
+PRESENT = 0x1FF  # Every field
+LATENCY_RE = re.compile(r'^pcmon_latency_us\{stage="(\w+)",stat="(\w+)"\} (\d+)$', re.M)
+COUNTER_RE = re.compile(r"^(pcmon_packets_\w+_total) (\d+)$", re.M)
+
+
+def packet(seq):
+    now = time.localtime()
+    cpu = (seq * 37) % 1000  # Moves every packet, so every one is a new frame
+    body = PACKET_FORMAT.pack(PACKET_MAGIC, PACKET_VERSION, FLAG_SEND_TIME, seq & 0xFFFF, PRESENT,
+                              cpu, 500, 160, 320, 480, 55, 48, 1500, now.tm_hour, now.tm_min)
+    return body + struct.pack("<I", int(time.monotonic() * 1000) & 0xFFFFFFFF)
+
+
+def scrape(host):
+    with socket.create_connection((host, 80), timeout=5.0) as s:
+        s.sendall(b"GET /metrics HTTP/1.1\r\n\r\n")
+        data = b""
+        while True:
+            chunk = s.recv(4096)
+            if not chunk:
+                break
+            data += chunk
+    text = data.split(b"\r\n\r\n", 1)[-1].decode(errors="replace")
+    latency = {(m[0], m[1]): int(m[2]) for m in LATENCY_RE.findall(text)}
+    counters = {m[0]: int(m[1]) for m in COUNTER_RE.findall(text)}
+    return latency, counters
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("host", help="ESP32 IP address")
+    parser.add_argument("--packets", type=int, default=400)
+    parser.add_argument("--interval", type=float, default=0.05, help="seconds between packets")
+    parser.add_argument("--drop-every", type=int, default=50)
+    parser.add_argument("--reorder-every", type=int, default=40)
+    args = parser.parse_args()
+
+    _, before = scrape(args.host)
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    dropped = reordered = 0
+    held = None
+    for seq in range(args.packets):
+        last = seq == args.packets - 1
+        if seq % args.drop_every == args.drop_every - 1 and not last:
+            dropped += 1  # A trailing loss would never be noticed
+        elif seq % args.reorder_every == args.reorder_every // 2 and not last and held is None:
+            held = packet(seq)  # Goes out after the next one
+            dropped += 1        # The gap counts as a loss until it turns up late
+            reordered += 1
+        else:
+            sock.sendto(packet(seq), (args.host, UDP_PORT))
+            if held is not None:
+                sock.sendto(held, (args.host, UDP_PORT))
+                held = None
+        time.sleep(args.interval)
+    sock.close()
+
+    time.sleep(0.5)
+    latency, after = scrape(args.host)
+
+    def delta(name):
+        return after.get(name, 0) - before.get(name, 0)
+
+    print("sent %d packets, %d left out, %d reordered" % (args.packets, dropped - reordered, reordered))
+    for name, expected in (("pcmon_packets_dropped_total", dropped),
+                           ("pcmon_packets_reordered_total", reordered)):
+        got = delta(name)
+        print("  %-32s %5d  expected %5d  %s" % (name, got, expected, "ok" if got == expected else "MISMATCH"))
+    print("latency (last 128 packets, all senders):")
+    for stage in ("network", "parse", "display"):
+        print("  %-8s p50 %6d us   p99 %6d us   max %6d us" % (
+            stage, latency.get((stage, "p50"), 0), latency.get((stage, "p99"), 0),
+            latency.get((stage, "max"), 0)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""
+Hammer the monitor's web server and check that rendering doesn't notice.
+
+Reads the frame/render timings from /metrics while idle, then again while
+worker threads load /, /api/settings and /metrics as fast as they can,
+with some of them reading slowly (a phone on weak Wi-Fi) or stalling
+mid-request. Prints both sets of timings side by side.
+
+    python3 tools/http_load.py 192.168.0.19 --seconds 30 --workers 8
+"""
+
+import argparse
+import re
+import socket
+import threading
+import time
+
+PATHS = ["/", "/api/settings", "/metrics"]
+STAGE_RE = re.compile(r'^pcmon_stage_us\{stage="(\w+)",stat="(\w+)"\} (\d+)$', re.M)
+GAUGE_RE = re.compile(r"^(pcmon_\w+) (\d+)$", re.M)
+
+
+def http_get(host, path, timeout=5.0, slow=False, stall=False):
+    """One request on a fresh connection; returns the status code or None"""
+    with socket.create_connection((host, 80), timeout=timeout) as s:
+        if slow:
+            s.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 256)
+        request = "GET %s HTTP/1.1\r\nHost: %s\r\nAccept-Encoding: gzip\r\n" % (path, host)
+        if stall:
+            s.sendall(request.encode())  # Never finish the headers
+            time.sleep(timeout)
+            return None
+        s.sendall((request + "\r\n").encode())
+        data = b""
+        while True:
+            chunk = s.recv(64 if slow else 4096)
+            if not chunk:
+                break
+            data += chunk
+            if slow:
+                time.sleep(0.01)
+    m = re.match(rb"HTTP/1\.1 (\d+)", data)
+    return int(m.group(1)) if m else None
+
+
+def scrape(host):
+    with socket.create_connection((host, 80), timeout=5.0) as s:
+        s.sendall(b"GET /metrics HTTP/1.1\r\n\r\n")
+        data = b""
+        while True:
+            chunk = s.recv(4096)
+            if not chunk:
+                break
+            data += chunk
+    text = data.split(b"\r\n\r\n", 1)[-1].decode(errors="replace")
+    stages = {(m[0], m[1]): int(m[2]) for m in STAGE_RE.findall(text)}
+    gauges = {m[0]: int(m[1]) for m in GAUGE_RE.findall(text)}
+    return stages, gauges
+
+
+def worker(host, index, stop, counts, lock):
+    slow = index % 4 == 1
+    stall = index % 4 == 3
+    n = 0
+    while not stop.is_set():
+        try:
+            status = http_get(host, PATHS[n % len(PATHS)], slow=slow, stall=stall)
+        except OSError:
+            status = "error"
+        n += 1
+        with lock:
+            counts[status] = counts.get(status, 0) + 1
+
+
+def report(label, stages, gauges):
+    def stage(name, stat):
+        return stages.get((name, stat), 0)
+    print("%-8s frame avg/p99/max %5d/%5d/%5d us   render p99 %5d us   http p99 %5d us   "
+          "%d fps" % (label, stage("frame", "avg"), stage("frame", "p99"), stage("frame", "max"),
+                      stage("render", "p99"), stage("http", "p99"),
+                      gauges.get("pcmon_frames_per_second", 0)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("host", help="ESP32 IP address")
+    parser.add_argument("--seconds", type=float, default=20, help="load duration")
+    parser.add_argument("--workers", type=int, default=8, help="concurrent clients")
+    args = parser.parse_args()
+
+    # Stage stats cover the last 128 samples; let the idle ones settle
+    time.sleep(2)
+    report("idle", *scrape(args.host))
+
+    stop = threading.Event()
+    counts, lock = {}, threading.Lock()
+    threads = [threading.Thread(target=worker, args=(args.host, i, stop, counts, lock), daemon=True)
+               for i in range(args.workers)]
+    for t in threads:
+        t.start()
+    time.sleep(args.seconds)
+
+    try:
+        stages, gauges = scrape(args.host)
+    except OSError as e:
+        stages, gauges = {}, {}
+        print("metrics scrape under load failed: %s" % e)
+    stop.set()
+    report("loaded", stages, gauges)
+    print("responses: %s" % ", ".join("%s x%d" % (k, v) for k, v in sorted(counts.items(), key=str)))
+    print("http: %d rejected, %d timed out" % (gauges.get("pcmon_http_rejected_total", 0),
+                                                gauges.get("pcmon_http_timeouts_total", 0)))
+
+
+if __name__ == "__main__":
+    main()